@@ -0,0 +1,1213 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  DecodeRegressionExample.cpp                                     */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#include "ReedSolomon.hpp"
+#include <random>
+
+// Using namespace for ReedSolomon lib
+using namespace RS;
+
+// Core decode paths and those that broke before. Every case is built from a fixed seed, so a failure is reproducible.
+// Returns a nonzero exit code if any case fails, the example is also registered as test.
+
+namespace
+{
+uint64_t g_NumOfFailures = 0;
+
+void Report(const std::string& name, const uint64_t numOfPassed, const uint64_t numOfCases)
+{
+    std::cout << (numOfPassed == numOfCases ? "PASS " : "FAIL ") << name << ": " << numOfPassed << "/" << numOfCases << std::endl;
+    
+    if(numOfPassed != numOfCases)
+        g_NumOfFailures++;
+}
+
+// Random message of length - nsym symbols, encoded
+std::vector<RSWord> RandomCodeword(const ReedSolomon& rs, const uint64_t length, std::mt19937& rng)
+{
+    std::vector<RSWord> message(length - rs.m_NumOfErrorCorrectingSymbols);
+    for(RSWord& symbol : message)
+        symbol = static_cast<RSWord>(rng());
+    
+    return rs.Encode(message);
+}
+
+// Distinct positions < length
+std::vector<uint64_t> RandomPositions(const uint64_t count, const uint64_t length, std::mt19937& rng)
+{
+    std::vector<uint64_t> positions(length);
+    for(uint64_t i = 0; i < length; i++)
+        positions[i] = i;
+    
+    std::shuffle(positions.begin(), positions.end(), rng);
+    positions.resize(count);
+    
+    return positions;
+}
+
+// Long codes with many erasures and errors within 2 * errors + erasures <= nsym. The error evaluator used to
+// build the full product of syndromes and erasure locator, which overflowed the inline polynomial storage.
+void LongCodesWithHeavyErasures()
+{
+    constexpr uint64_t numOfCases = 200;
+    std::mt19937 rng(28);
+    uint64_t numOfPassed = 0;
+    
+    for(uint64_t c = 0; c < numOfCases; c++)
+    {
+        const uint64_t nsym = 150 + rng() % 91;
+        const uint64_t length = 255;
+        const ReedSolomon rs(8, nsym);
+        
+        const std::vector<RSWord> codeword = RandomCodeword(rs, length, rng);
+        const uint64_t numOfErasures = nsym / 2 + rng() % (nsym / 2 + 1);
+        const uint64_t numOfErrors = (nsym - numOfErasures) / 2;
+        
+        const std::vector<uint64_t> positions = RandomPositions(numOfErasures + numOfErrors, length, rng);
+        const std::vector<uint64_t> erasurePositions(positions.begin(), positions.begin() + static_cast<int64_t>(numOfErasures));
+        
+        std::vector<RSWord> corrupted = codeword;
+        for(const uint64_t position : positions)
+            corrupted[position] ^= static_cast<RSWord>(1 + rng() % 255);
+        
+        try
+        {
+            const std::vector<RSWord> decoded = rs.Decode(corrupted, &erasurePositions);
+            
+            if(std::equal(decoded.begin(), decoded.end(), codeword.begin()))
+                numOfPassed++;
+        }
+        catch(const std::exception& e)
+        {
+            std::cout << "  nsym " << nsym << ", " << numOfErasures << " erasures, " << numOfErrors << " errors: " << e.what() << std::endl;
+        }
+    }
+    
+    Report("Long codes with heavy erasures", numOfPassed, numOfCases);
+}
+
+// Random message of messageLength symbols
+std::vector<RSWord> RandomMessage(const uint64_t messageLength, std::mt19937& rng)
+{
+    std::vector<RSWord> message(messageLength);
+    for(RSWord& symbol : message)
+        symbol = static_cast<RSWord>(rng());
+    
+    return message;
+}
+
+// Flips the symbols at positions to other values
+void Corrupt(std::vector<RSWord>& codeword, const std::vector<uint64_t>& positions, std::mt19937& rng)
+{
+    for(const uint64_t position : positions)
+        codeword[position] ^= static_cast<RSWord>(1 + rng() % 255);
+}
+
+// Errors only, up to nsym / 2 of them at unknown positions. The number of errors found must match.
+void ErrorsOnly()
+{
+    constexpr uint64_t numOfCases = 500;
+    std::mt19937 rng(1);
+    uint64_t numOfPassed = 0;
+    
+    for(uint64_t c = 0; c < numOfCases; c++)
+    {
+        const uint64_t nsym = 2 + rng() % 63;
+        const uint64_t length = nsym + 1 + rng() % (255 - nsym);
+        const ReedSolomon rs(8, nsym);
+        
+        const std::vector<RSWord> codeword = RandomCodeword(rs, length, rng);
+        const uint64_t numOfErrors = rng() % (nsym / 2 + 1);
+        
+        std::vector<RSWord> corrupted = codeword;
+        Corrupt(corrupted, RandomPositions(numOfErrors, length, rng), rng);
+        
+        try
+        {
+            uint64_t numOfErrorsFound = 0;
+            const std::vector<RSWord> decoded = rs.Decode(corrupted, nullptr, &numOfErrorsFound);
+            
+            if(std::equal(decoded.begin(), decoded.end(), codeword.begin()) && numOfErrorsFound == numOfErrors)
+                numOfPassed++;
+        }
+        catch(const std::exception& e)
+        {
+            std::cout << "  nsym " << nsym << ", " << numOfErrors << " errors: " << e.what() << std::endl;
+        }
+    }
+    
+    Report("Errors only", numOfPassed, numOfCases);
+}
+
+// Parameters beyond the symbol size or the codeword length are rejected up front. More than 8 bits per word used
+// to pass and overflowed the inline decoder buffers.
+void InvalidParameters()
+{
+    const GaloisField galoisField9(9);
+    const std::vector<std::pair<uint64_t, uint64_t>> parameters = {{9, 300}, {9, 4}, {16, 2}, {8, 255}, {8, 0}, {4, 15}};
+    uint64_t numOfPassed = 0;
+    
+    for(const auto& [bitsPerWord, nsym] : parameters)
+    {
+        try
+        {
+            const ReedSolomon rs(bitsPerWord, nsym);
+        }
+        catch(const std::invalid_argument&)
+        {
+            numOfPassed++;
+        }
+    }
+    
+    try
+    {
+        const ReedSolomon rs(galoisField9, 300);
+    }
+    catch(const std::invalid_argument&)
+    {
+        numOfPassed++;
+    }
+    
+    Report("Invalid parameters", numOfPassed, parameters.size() + 1);
+}
+
+// Up to nsym erasures and no errors, through the erasure only decoder and the general decoder. The error count
+// check used to underflow for them.
+void ErasuresOnly()
+{
+    constexpr uint64_t numOfCases = 500;
+    std::mt19937 rng(2);
+    uint64_t numOfPassed = 0;
+    
+    for(uint64_t c = 0; c < numOfCases; c++)
+    {
+        const uint64_t nsym = 1 + rng() % 64;
+        const uint64_t length = nsym + 1 + rng() % (255 - nsym);
+        const ReedSolomon rs(8, nsym);
+        
+        const std::vector<RSWord> codeword = RandomCodeword(rs, length, rng);
+        const std::vector<uint64_t> erasurePositions = RandomPositions(1 + rng() % nsym, length, rng);
+        
+        std::vector<RSWord> corrupted = codeword;
+        Corrupt(corrupted, erasurePositions, rng);
+        
+        try
+        {
+            std::vector<RSWord> erasuresOnly = corrupted;
+            const bool isDecoded = rs.DecodeErasuresInPlace(erasuresOnly, erasurePositions);
+            const std::vector<RSWord> decoded = rs.Decode(corrupted, &erasurePositions);
+            
+            if(isDecoded && erasuresOnly == codeword && std::equal(decoded.begin(), decoded.end(), codeword.begin()))
+                numOfPassed++;
+        }
+        catch(const std::exception& e)
+        {
+            std::cout << "  nsym " << nsym << ", " << erasurePositions.size() << " erasures: " << e.what() << std::endl;
+        }
+    }
+    
+    Report("Erasures only", numOfPassed, numOfCases);
+}
+
+// In place decoding reports every changed symbol, clean codewords are left alone
+void DecodeInPlaceCorrections()
+{
+    constexpr uint64_t numOfCases = 300;
+    std::mt19937 rng(3);
+    uint64_t numOfPassed = 0;
+    
+    for(uint64_t c = 0; c < numOfCases; c++)
+    {
+        const uint64_t nsym = 2 + rng() % 63;
+        const uint64_t length = nsym + 1 + rng() % (255 - nsym);
+        const ReedSolomon rs(8, nsym);
+        
+        const std::vector<RSWord> codeword = RandomCodeword(rs, length, rng);
+        const uint64_t numOfErasures = rng() % (nsym + 1);
+        const uint64_t numOfErrors = (nsym - numOfErasures) / 2;
+        
+        const std::vector<uint64_t> positions = RandomPositions(numOfErasures + numOfErrors, length, rng);
+        const std::vector<uint64_t> erasurePositions(positions.begin(), positions.begin() + static_cast<int64_t>(numOfErasures));
+        
+        std::vector<RSWord> corrupted = codeword;
+        Corrupt(corrupted, positions, rng);
+        
+        try
+        {
+            std::vector<RSWord> clean = codeword;
+            std::vector<Correction> corrections;
+            const bool isCleanUntouched = rs.DecodeInPlace(clean, nullptr, &corrections) == 0 && corrections.empty() && clean == codeword;
+            
+            std::vector<RSWord> serial = corrupted;
+            rs.DecodeInPlace(serial, &erasurePositions, &corrections);
+            
+            // Replaying the corrections on the corrupted codeword must give the decoded one
+            std::vector<RSWord> replayed = corrupted;
+            for(const Correction& correction : corrections)
+                replayed[correction.position] ^= correction.magnitude;
+            
+            
+            if(isCleanUntouched && serial == codeword && replayed == codeword)
+                numOfPassed++;
+        }
+        catch(const std::exception& e)
+        {
+            std::cout << "  nsym " << nsym << ", " << numOfErasures << " erasures, " << numOfErrors << " errors: " << e.what() << std::endl;
+        }
+    }
+    
+    Report("Decode in place with corrections", numOfPassed, numOfCases);
+}
+
+// Parity and checks over a codeword split into fragments must match the contiguous codeword
+void ScatterGather()
+{
+    constexpr uint64_t numOfCases = 300;
+    std::mt19937 rng(4);
+    uint64_t numOfPassed = 0;
+    
+    for(uint64_t c = 0; c < numOfCases; c++)
+    {
+        const uint64_t nsym = 1 + rng() % 64;
+        const uint64_t length = nsym + 1 + rng() % (255 - nsym);
+        const ReedSolomon rs(8, nsym);
+        
+        std::vector<RSWord> codeword = RandomCodeword(rs, length, rng);
+        const uint64_t messageLength = length - nsym;
+        const uint64_t split = rng() % (messageLength + 1);
+        
+        const std::array<std::span<const RSWord>, 2> messageFragments = {std::span<const RSWord>(codeword.data(), split), std::span<const RSWord>(codeword.data() + split, messageLength - split)};
+        std::vector<RSWord> parity(nsym);
+        rs.CalculateParity(messageFragments, parity.data());
+        
+        const std::array<std::span<const RSWord>, 3> codewordFragments = {messageFragments[0], messageFragments[1], std::span<const RSWord>(codeword.data() + messageLength, nsym)};
+        const bool isParityEqual = std::equal(parity.begin(), parity.end(), codewordFragments[2].begin());
+        const bool isClean = !rs.IsMessageCorrupted(codewordFragments);
+        
+        codeword[rng() % length] ^= static_cast<RSWord>(1 + rng() % 255);
+        const bool isCorrupted = rs.IsMessageCorrupted(codewordFragments);
+        
+        if(isParityEqual && isClean && isCorrupted)
+            numOfPassed++;
+    }
+    
+    Report("Scatter-gather parity and checks", numOfPassed, numOfCases);
+}
+
+// Encode and decode with caller supplied memory
+void MemoryResourcePaths()
+{
+    constexpr uint64_t numOfCases = 200;
+    std::mt19937 rng(5);
+    std::array<std::byte, 4096> buffer;
+    uint64_t numOfPassed = 0;
+    
+    for(uint64_t c = 0; c < numOfCases; c++)
+    {
+        const uint64_t nsym = 2 + rng() % 63;
+        const uint64_t messageLength = 1 + rng() % (255 - nsym);
+        const ReedSolomon rs(8, nsym);
+        std::pmr::monotonic_buffer_resource resource(buffer.data(), buffer.size(), std::pmr::null_memory_resource());
+        
+        const std::vector<RSWord> message = RandomMessage(messageLength, rng);
+        std::pmr::vector<RSWord> codeword = rs.Encode(message, &resource);
+        
+        const uint64_t numOfErrors = rng() % (nsym / 2 + 1);
+        for(const uint64_t position : RandomPositions(numOfErrors, codeword.size(), rng))
+            codeword[position] ^= static_cast<RSWord>(1 + rng() % 255);
+        
+        try
+        {
+            const std::pmr::vector<RSWord> decoded = rs.Decode(codeword, &resource);
+            
+            if(std::equal(decoded.begin(), decoded.end(), message.begin(), message.end()))
+                numOfPassed++;
+        }
+        catch(const std::exception& e)
+        {
+            std::cout << "  nsym " << nsym << ", " << numOfErrors << " errors: " << e.what() << std::endl;
+        }
+    }
+    
+    Report("Memory resource encode and decode", numOfPassed, numOfCases);
+}
+
+// Synchronous, allocation free and asynchronous decoding through the shared codec service
+void CodecServicePaths()
+{
+    constexpr uint64_t numOfCases = 200;
+    constexpr uint64_t nsym = 32;
+    std::mt19937 rng(6);
+    CodecService service(std::make_shared<const ReedSolomon>(8, nsym), 4);
+    uint64_t numOfPassed = 0;
+    
+    std::vector<std::future<DecodeResult>> futures;
+    std::vector<std::vector<RSWord>> messages;
+    
+    for(uint64_t c = 0; c < numOfCases; c++)
+    {
+        const std::vector<RSWord> message = RandomMessage(1 + rng() % (255 - nsym), rng);
+        std::vector<RSWord> codeword = service.Encode(message);
+        
+        const std::vector<uint64_t> positions = RandomPositions(rng() % (nsym / 2 + 1), codeword.size(), rng);
+        Corrupt(codeword, positions, rng);
+        
+        try
+        {
+            const DecodeResult result = service.Decode(codeword);
+            
+            std::vector<RSWord> decoded(message.size());
+            const uint64_t numOfErrorsFound = service.Decode(codeword, decoded);
+            
+            if(result.message == message && result.numOfErrorsFound == positions.size() && decoded == message && numOfErrorsFound == positions.size())
+                numOfPassed++;
+        }
+        catch(const std::exception& e)
+        {
+            std::cout << "  " << positions.size() << " errors: " << e.what() << std::endl;
+        }
+        
+        futures.push_back(service.SubmitDecode(std::move(codeword)));
+        messages.push_back(message);
+    }
+    
+    Report("Codec service decode", numOfPassed, numOfCases);
+    
+    numOfPassed = 0;
+    
+    for(uint64_t c = 0; c < numOfCases; c++)
+    {
+        try
+        {
+            if(futures[c].get().message == messages[c])
+                numOfPassed++;
+        }
+        catch(const std::exception& e)
+        {
+            std::cout << "  " << e.what() << std::endl;
+        }
+    }
+    
+    Report("Codec service submitted decode", numOfPassed, numOfCases);
+}
+
+// Every parity length of the rate compatible codec must encode and decode like its own codec
+void RateCompatibleParityLengths()
+{
+    constexpr uint64_t maxNsym = 64;
+    constexpr uint64_t casesPerLength = 5;
+    std::mt19937 rng(7);
+    const RateCompatibleCodec rateCompatible(8, maxNsym);
+    uint64_t numOfPassed = 0;
+    
+    for(uint64_t nsym = 1; nsym <= maxNsym; nsym++)
+    {
+        const ReedSolomon rs(8, nsym);
+        
+        for(uint64_t c = 0; c < casesPerLength; c++)
+        {
+            const std::vector<RSWord> message = RandomMessage(1 + rng() % (255 - nsym), rng);
+            const std::vector<RSWord> codeword = rateCompatible.Encode(message, nsym);
+            
+            const uint64_t numOfErasures = rng() % (nsym + 1);
+            const std::vector<uint64_t> positions = RandomPositions(numOfErasures + (nsym - numOfErasures) / 2, codeword.size(), rng);
+            const std::vector<uint64_t> erasurePositions(positions.begin(), positions.begin() + static_cast<int64_t>(numOfErasures));
+            
+            std::vector<RSWord> corrupted = codeword;
+            Corrupt(corrupted, positions, rng);
+            
+            try
+            {
+                const std::vector<RSWord> decoded = rateCompatible.Decode(corrupted, nsym, &erasurePositions);
+                
+                if(codeword == rs.Encode(message) && decoded == message && !rateCompatible.IsMessageCorrupted(codeword, nsym))
+                    numOfPassed++;
+            }
+            catch(const std::exception& e)
+            {
+                std::cout << "  nsym " << nsym << ", " << positions.size() << " corrupted symbols: " << e.what() << std::endl;
+            }
+        }
+    }
+    
+    Report("Rate compatible parity lengths", numOfPassed, maxNsym * casesPerLength);
+}
+
+// Errors confined to a few sub-blocks are corrected as erasures, damaged checksums through the fallback
+void SubBlockChecksums()
+{
+    constexpr uint64_t numOfCases = 200;
+    constexpr uint64_t nsym = 16;
+    std::mt19937 rng(8);
+    const ReedSolomon rs(8, nsym);
+    uint64_t numOfPassed = 0;
+    
+    for(uint64_t c = 0; c < numOfCases; c++)
+    {
+        // Message, one checksum per sub-block and parity fit into 255 symbols
+        const uint64_t subBlockSize = 1 + rng() % 2;
+        const SubBlockCodec codec(rs, subBlockSize);
+        const std::vector<RSWord> message = RandomMessage(1 + rng() % ((255 - nsym) * subBlockSize / (subBlockSize + 1)), rng);
+        std::vector<RSWord> codeword = codec.Encode(message);
+        
+        Corrupt(codeword, RandomPositions(rng() % (nsym / 2 + 1), codeword.size(), rng), rng);
+        
+        try
+        {
+            if(codec.Decode(codeword) == message)
+                numOfPassed++;
+        }
+        catch(const std::exception& e)
+        {
+            std::cout << "  sub-block size " << codec.GetSubBlockSize() << ": " << e.what() << std::endl;
+        }
+    }
+    
+    Report("Sub-block checksums", numOfPassed, numOfCases);
+    
+    // Bursts beyond plain decoding at the same rate: sub-blocks of 16 with nsym 96 against nsym 106 (96 parity
+    // symbols plus 10 checksums). Bursts of 54 to 81 message symbols, which plain decoding cannot correct.
+    // A damaged sub-block passing its one byte checksum (1/256 each) makes a burst fail, 97% must be corrected.
+    const ReedSolomon burstCodec(8, 96);
+    const ReedSolomon plainCodec(8, 106);
+    const SubBlockCodec codec(burstCodec, 16);
+    constexpr uint64_t messageLength = 149;
+    uint64_t numOfPlainPassed = 0;
+    numOfPassed = 0;
+    
+    for(uint64_t c = 0; c < numOfCases; c++)
+    {
+        const std::vector<RSWord> message = RandomMessage(messageLength, rng);
+        std::vector<RSWord> codeword = codec.Encode(message);
+        std::vector<RSWord> plainCodeword = plainCodec.Encode(message);
+        
+        const uint64_t burstLength = 54 + rng() % 28;
+        const uint64_t position = rng() % (messageLength - burstLength + 1);
+        for(uint64_t i = position; i < position + burstLength; i++)
+        {
+            const RSWord error = static_cast<RSWord>(1 + rng() % 255);
+            codeword[i] ^= error;
+            plainCodeword[i] ^= error;
+        }
+        
+        try
+        {
+            if(codec.Decode(codeword) == message)
+                numOfPassed++;
+        }
+        catch(const std::exception&)
+        {
+        }
+        
+        try
+        {
+            if(plainCodec.Decode(plainCodeword) == message)
+                numOfPlainPassed++;
+        }
+        catch(const std::exception&)
+        {
+        }
+    }
+    
+    std::cout << "  sub-blocks corrected " << numOfPassed << ", plain decoding " << numOfPlainPassed << " of " << numOfCases << " bursts" << std::endl;
+    Report("Sub-block bursts beyond plain decoding", (numOfPassed * 100 >= numOfCases * 97 && numOfPlainPassed == 0) ? 1 : 0, 1);
+}
+
+// A burst of 3 x 3 symbols exceeds both the row (nsym 4) and the column code (nsym 2), so the first iteration only
+// marks rows and columns as failed. The second row pass corrects the burst with the failed columns as erasures,
+// decoding used to stop before it because the first iteration corrected nothing.
+void ProductCodeBursts()
+{
+    constexpr uint64_t numOfCases = 200;
+    constexpr uint64_t burstSize = 3;
+    std::mt19937 rng(44);
+    const ProductCode productCode(10, 10, 4, 2, 2);
+    uint64_t numOfPassed = 0;
+    
+    for(uint64_t c = 0; c < numOfCases; c++)
+    {
+        const std::vector<RSWord> data = RandomMessage(100, rng);
+        std::vector<RSWord> block = productCode.Encode(data);
+        
+        const uint64_t firstRow = rng() % (productCode.GetNumberOfRows() - burstSize + 1);
+        const uint64_t firstColumn = rng() % (productCode.GetNumberOfColumns() - burstSize + 1);
+        
+        for(uint64_t row = firstRow; row < firstRow + burstSize; row++)
+        {
+            for(uint64_t column = firstColumn; column < firstColumn + burstSize; column++)
+                block[row * productCode.GetNumberOfColumns() + column] ^= static_cast<RSWord>(1 + rng() % 255);
+        }
+        
+        const ProductCodeReport report = productCode.Decode(block);
+        
+        if(report.success && productCode.ExtractData(block) == data)
+            numOfPassed++;
+    }
+    
+    Report("Product code bursts", numOfPassed, numOfCases);
+}
+
+// Container files of both layouts, with and without chunk checksums, read back after damaging chunk bytes
+void ContainerRoundTrips()
+{
+    constexpr uint64_t nsym = 16;
+    constexpr uint64_t dataSize = 50000;
+    std::mt19937 rng(9);
+    const ReedSolomon rs(8, nsym);
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "DecodeRegressionExample.rscf";
+    uint64_t numOfCases = 0;
+    uint64_t numOfPassed = 0;
+    
+    for(const ContainerLayout layout : {ContainerLayout::Interleaved, ContainerLayout::Sidecar})
+    {
+        for(const bool chunkChecksums : {false, true})
+        {
+            numOfCases++;
+            
+            const std::vector<RSWord> data = RandomMessage(dataSize, rng);
+            ContainerHeader header;
+            
+            try
+            {
+                {
+                    ContainerWriter writer(path, rs, 4096, layout, 0, chunkChecksums);
+                    writer.Write(data);
+                    writer.Finish();
+                    header = writer.GetHeader();
+                }
+                
+                // Chunks follow the header back to back, a few damaged bytes per chunk stay far below nsym / 2 per codeword
+                {
+                    uint64_t chunksSize = 0;
+                    for(uint64_t offset = 0; offset < dataSize; offset += header.chunkSize)
+                        chunksSize += header.GetStoredChunkSize(std::min(header.chunkSize, dataSize - offset));
+                    
+                    std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+                    
+                    for(uint64_t i = 0; i < 3 * header.numOfChunks; i++)
+                    {
+                        file.seekp(static_cast<std::streamoff>(ContainerHeader::Size + rng() % chunksSize));
+                        file.put(static_cast<char>(rng()));
+                    }
+                }
+                
+                ContainerReader reader(path);
+                
+                if(reader.Read(0, dataSize) == data)
+                    numOfPassed++;
+            }
+            catch(const std::exception& e)
+            {
+                std::cout << "  layout " << static_cast<uint32_t>(layout) << ", chunk checksums " << chunkChecksums << ": " << e.what() << std::endl;
+            }
+        }
+    }
+    
+    std::filesystem::remove(path);
+    
+    Report("Container round trips", numOfPassed, numOfCases);
+}
+
+// Consumes DecodeChunks() from a coroutine
+AsyncTask<std::vector<RSWord>> CollectChunks(const AsyncCodec& asyncCodec, std::vector<RSWord> codewords, const uint64_t messageLength)
+{
+    AsyncGenerator<std::vector<RSWord>> chunks = asyncCodec.DecodeChunks(std::move(codewords), messageLength);
+    std::vector<RSWord> result;
+    
+    while(const std::optional<std::vector<RSWord>> chunk = co_await chunks.Next())
+        result.insert(result.end(), chunk->begin(), chunk->end());
+    
+    co_return result;
+}
+
+// Async codec against the synchronous one with chunk sizes splitting the data into several steps
+void AsyncCodecPaths()
+{
+    constexpr uint64_t numOfCases = 50;
+    constexpr uint64_t nsym = 16;
+    std::mt19937 rng(49);
+    const std::shared_ptr<const ReedSolomon> codec = std::make_shared<const ReedSolomon>(8, nsym);
+    ThreadPool threadPool(4);
+    uint64_t numOfPassed = 0;
+    
+    for(uint64_t c = 0; c < numOfCases; c++)
+    {
+        const uint64_t messageLength = 1 + rng() % (255 - nsym);
+        const std::vector<RSWord> data = RandomMessage(1 + rng() % 5000, rng);
+        const AsyncCodec asyncCodec(codec, AsyncCodec::MakeExecutor(threadPool), {}, 1 + rng() % 2048);
+        
+        // Every message encoded on its own, the last one may be shorter
+        std::vector<RSWord> expected;
+        for(uint64_t offset = 0; offset < data.size(); offset += messageLength)
+        {
+            const std::vector<RSWord> message(data.begin() + static_cast<std::ptrdiff_t>(offset), data.begin() + static_cast<std::ptrdiff_t>(std::min(data.size(), offset + messageLength)));
+            const std::vector<RSWord> codeword = codec->Encode(message);
+            expected.insert(expected.end(), codeword.begin(), codeword.end());
+        }
+        
+        try
+        {
+            std::vector<RSWord> codewords = SyncWait(asyncCodec.Encode(data, messageLength));
+            const bool encoded = codewords == expected;
+            
+            // Up to nsym / 2 errors in every codeword
+            for(uint64_t offset = 0; offset < codewords.size(); offset += messageLength + nsym)
+            {
+                const uint64_t length = std::min(messageLength + nsym, codewords.size() - offset);
+                
+                for(const uint64_t position : RandomPositions(rng() % (nsym / 2 + 1), length, rng))
+                    codewords[offset + position] ^= static_cast<RSWord>(1 + rng() % 255);
+            }
+            
+            const DecodeResult result = SyncWait(asyncCodec.Decode(codewords, messageLength));
+            const std::vector<RSWord> chunks = SyncWait(CollectChunks(asyncCodec, codewords, messageLength));
+            
+            if(encoded && result.message == data && chunks == data)
+                numOfPassed++;
+        }
+        catch(const std::exception& e)
+        {
+            std::cout << "  message length " << messageLength << ": " << e.what() << std::endl;
+        }
+    }
+    
+    Report("Async codec encode and decode", numOfPassed, numOfCases);
+    
+    // An executor failing after some steps were posted: the posted steps still run on the pool, the awaiting
+    // coroutine must only resume after them and report the executor's error
+    numOfPassed = 0;
+    
+    for(uint64_t c = 0; c < numOfCases; c++)
+    {
+        const uint64_t messageLength = 1 + rng() % 64;
+        const std::vector<RSWord> data = RandomMessage(messageLength * (1 + rng() % 40), rng);
+        const uint64_t numOfPosts = rng() % (data.size() / messageLength);
+        std::atomic<uint64_t> posted = 0;
+        
+        const AsyncCodec asyncCodec(codec, [&](std::function<void()> work)
+        {
+            if(posted == numOfPosts)
+                throw std::runtime_error("Executor is full.");
+            
+            posted++;
+            (void)threadPool.Submit(std::move(work));
+        }, {}, 1);
+        
+        try
+        {
+            (void)SyncWait(asyncCodec.Encode(data, messageLength));
+            std::cout << "  " << numOfPosts << " posts: no error" << std::endl;
+        }
+        catch(const std::runtime_error& e)
+        {
+            if(std::string(e.what()) == "Executor is full.")
+                numOfPassed++;
+        }
+    }
+    
+    Report("Async codec failing executor", numOfPassed, numOfCases);
+}
+
+// The GFNI backend against table lookups. Lengths are not multiples of the vector width, so the scalar tails run
+// too. Without GFNI support both fields use the tables and the case passes trivially.
+void GfniMatchesTables()
+{
+    constexpr uint64_t numOfCases = 100;
+    std::mt19937 rng(30);
+    const GaloisField hardwareField(8, true);
+    const GaloisField tableField(8, false);
+    uint64_t numOfPassed = 0;
+    
+    std::cout << "  backend: " << (hardwareField.GetBackend() == GaloisFieldBackend::GFNI ? "GFNI" : "table") << std::endl;
+    
+    bool multiplied = true;
+    for(uint64_t x = 0; x < 256; x++)
+    {
+        for(uint64_t y = 0; y < 256; y++)
+            multiplied = multiplied && hardwareField.Multiply(static_cast<RSWord>(x), static_cast<RSWord>(y)) == tableField.Multiply(static_cast<RSWord>(x), static_cast<RSWord>(y));
+    }
+    
+    Report("GFNI multiply", multiplied ? 1 : 0, 1);
+    
+    for(uint64_t c = 0; c < numOfCases; c++)
+    {
+        const uint64_t length = 1 + rng() % 1000;
+        const RSWord factor = static_cast<RSWord>(rng());
+        const std::vector<RSWord> source = RandomMessage(length, rng);
+        const std::vector<RSWord> destination = RandomMessage(length, rng);
+        
+        // Unaligned start as well
+        const uint64_t offset = rng() % std::min<uint64_t>(length, 7);
+        
+        std::vector<RSWord> hardwareRegion(length), tableRegion(length);
+        hardwareField.MultiplyRegion(hardwareRegion.data() + offset, source.data() + offset, factor, length - offset);
+        tableField.MultiplyRegion(tableRegion.data() + offset, source.data() + offset, factor, length - offset);
+        
+        std::vector<RSWord> hardwareAccumulated = destination, tableAccumulated = destination;
+        hardwareField.MultiplyAccumulate(hardwareAccumulated.data() + offset, source.data() + offset, factor, length - offset);
+        tableField.MultiplyAccumulate(tableAccumulated.data() + offset, source.data() + offset, factor, length - offset);
+        
+        if(hardwareRegion == tableRegion && hardwareAccumulated == tableAccumulated)
+            numOfPassed++;
+    }
+    
+    Report("GFNI region multiply and accumulate", numOfPassed, numOfCases);
+    
+    numOfPassed = 0;
+    
+    for(uint64_t c = 0; c < numOfCases; c++)
+    {
+        const uint64_t nsym = 1 + rng() % 64;
+        const ReedSolomon hardwareCodec(hardwareField, nsym);
+        const ReedSolomon tableCodec(tableField, nsym);
+        const std::vector<RSWord> message = RandomMessage(1 + rng() % (255 - nsym), rng);
+        
+        std::vector<RSWord> hardwareParity(nsym), tableParity(nsym);
+        hardwareCodec.CalculateParity(message.data(), message.size(), hardwareParity.data());
+        tableCodec.CalculateParity(message.data(), message.size(), tableParity.data());
+        
+        // Syndromes of a corrupted codeword, all zero would hide differences
+        std::vector<RSWord> codeword = message;
+        codeword.insert(codeword.end(), tableParity.begin(), tableParity.end());
+        Corrupt(codeword, RandomPositions(1 + rng() % nsym, codeword.size(), rng), rng);
+        
+        std::vector<RSWord> hardwareSyndromes(nsym), tableSyndromes(nsym);
+        hardwareCodec.CalculateSyndromes(codeword.data(), codeword.size(), hardwareSyndromes.data());
+        tableCodec.CalculateSyndromes(codeword.data(), codeword.size(), tableSyndromes.data());
+        
+        if(hardwareParity == tableParity && hardwareSyndromes == tableSyndromes)
+            numOfPassed++;
+    }
+    
+    Report("GFNI parity and syndromes", numOfPassed, numOfCases);
+}
+
+// Additive FFT codec round trips with every erasure count from 1 to nsym. Odd message lengths and parity lengths
+// that are not powers of two leave the last message chunk and the parity chunk partially filled.
+void AdditiveFFTRoundTrips()
+{
+    constexpr std::array<std::pair<uint64_t, uint64_t>, 6> configurations{{{1, 1}, {7, 3}, {33, 5}, {101, 37}, {1001, 129}, {4093, 255}}};
+    std::mt19937 rng(37);
+    uint64_t numOfCases = 0;
+    uint64_t numOfPassed = 0;
+    
+    for(const auto& [messageLength, nsym] : configurations)
+    {
+        const AdditiveFFTCodec codec(messageLength, nsym);
+        
+        std::vector<RSWord16> message(messageLength);
+        for(RSWord16& symbol : message)
+            symbol = static_cast<RSWord16>(rng());
+        
+        const std::vector<RSWord16> codeword = codec.Encode(message);
+        
+        std::vector<RSWord16> parity(nsym);
+        codec.CalculateParity(message.data(), parity.data());
+        
+        const bool encoded = codeword.size() == codec.GetCodewordLength() && std::equal(message.begin(), message.end(), codeword.begin()) &&
+                             std::equal(parity.begin(), parity.end(), codeword.begin() + static_cast<std::ptrdiff_t>(messageLength));
+        
+        for(uint64_t numOfErasures = 1; numOfErasures <= nsym; numOfErasures++)
+        {
+            numOfCases++;
+            
+            const std::vector<uint64_t> positions = RandomPositions(numOfErasures, codeword.size(), rng);
+            std::vector<RSWord16> received = codeword;
+            for(const uint64_t position : positions)
+                received[position] = static_cast<RSWord16>(rng());
+            
+            try
+            {
+                codec.DecodeErasures(received, positions);
+                
+                if(encoded && received == codeword)
+                    numOfPassed++;
+            }
+            catch(const std::exception& e)
+            {
+                std::cout << "  message length " << messageLength << ", nsym " << nsym << ", " << numOfErasures << " erasures: " << e.what() << std::endl;
+            }
+        }
+    }
+    
+    Report("Additive FFT round trips", numOfPassed, numOfCases);
+}
+
+// Tower field arithmetic against schoolbook multiplication in GF(2^8)[y] / (y^2 + y + mu), the field laws,
+// Log/Exp over the whole group and the region operations, with and without hardware acceleration
+void TowerFieldChecks()
+{
+    constexpr uint64_t numOfSamples = 100000;
+    std::mt19937 rng(38);
+    
+    for(const bool allowHardwareAcceleration : {false, true})
+    {
+        const TowerField field(allowHardwareAcceleration);
+        const GaloisField& base = field.GetBaseField();
+        const std::string name = allowHardwareAcceleration ? "Tower field (accelerated)" : "Tower field";
+        
+        // (a1 y + a0)(b1 y + b0) = a1 b1 (y + mu) + (a1 b0 + a0 b1) y + a0 b0
+        const auto reference = [&](const RSWord16 x, const RSWord16 y)
+        {
+            const RSWord a1 = static_cast<RSWord>(x >> 8), a0 = static_cast<RSWord>(x);
+            const RSWord b1 = static_cast<RSWord>(y >> 8), b0 = static_cast<RSWord>(y);
+            const RSWord high = base.Multiply(a1, b1);
+            
+            return static_cast<RSWord16>(((high ^ base.Multiply(a1, b0) ^ base.Multiply(a0, b1)) << 8) | (base.Multiply(a0, b0) ^ base.Multiply(field.GetMu(), high)));
+        };
+        
+        uint64_t numOfPassed = 0;
+        
+        for(uint64_t s = 0; s < numOfSamples; s++)
+        {
+            const RSWord16 x = static_cast<RSWord16>(rng()), y = static_cast<RSWord16>(rng()), z = static_cast<RSWord16>(rng());
+            const uint64_t power = rng() % 70000;
+            
+            // Pow() against the logarithm, 0^0 = 1
+            const RSWord16 expectedPower = (x == 0) ? (power == 0 ? 1 : 0) : field.Exp(field.Log(x) * power % TowerField::Modulus);
+            
+            bool passed = field.Multiply(x, y) == reference(x, y) &&
+                          field.Multiply(x, y) == field.Multiply(y, x) &&
+                          field.Multiply(field.Multiply(x, y), z) == field.Multiply(x, field.Multiply(y, z)) &&
+                          field.Multiply(x, field.Add(y, z)) == field.Add(field.Multiply(x, y), field.Multiply(x, z)) &&
+                          field.Multiply(x, 1) == x && field.Multiply(x, 0) == 0 &&
+                          field.Pow(x, power) == expectedPower;
+            
+            if(y != 0)
+                passed = passed && field.Multiply(y, field.Inverse(y)) == 1 && field.Multiply(field.Divide(x, y), y) == x;
+            
+            if(passed)
+                numOfPassed++;
+        }
+        
+        Report(name + " laws", numOfPassed, numOfSamples);
+        
+        // Exp enumerates the whole multiplicative group and Log inverts it
+        std::vector<bool> seen(TowerField::Cardinality, false);
+        bool logExp = true;
+        
+        for(uint64_t k = 0; k < TowerField::Modulus; k++)
+        {
+            const RSWord16 element = field.Exp(k);
+            logExp = logExp && element != 0 && !seen[element] && field.Log(element) == k && field.Exp(k + TowerField::Modulus) == element;
+            seen[element] = true;
+        }
+        
+        Report(name + " log and exp", logExp ? 1 : 0, 1);
+        
+        // Regions of odd lengths with both the factor and the product table overloads
+        numOfPassed = 0;
+        
+        for(uint64_t c = 0; c < 100; c++)
+        {
+            const uint64_t length = 1 + rng() % 999;
+            const RSWord16 factor = static_cast<RSWord16>(rng());
+            std::vector<RSWord16> source(length), destination(length);
+            for(uint64_t i = 0; i < length; i++)
+            {
+                source[i] = static_cast<RSWord16>(rng());
+                destination[i] = static_cast<RSWord16>(rng());
+            }
+            
+            std::vector<RSWord16> expectedRegion(length), expectedAccumulated = destination;
+            for(uint64_t i = 0; i < length; i++)
+            {
+                expectedRegion[i] = reference(factor, source[i]);
+                expectedAccumulated[i] ^= expectedRegion[i];
+            }
+            
+            const TowerField::ProductTable table = field.GetProductTable(factor);
+            std::vector<RSWord16> region(length), tableRegion(length), accumulated = destination, tableAccumulated = destination;
+            
+            field.MultiplyRegion(region.data(), source.data(), factor, length);
+            field.MultiplyRegion(tableRegion.data(), source.data(), table, length);
+            field.MultiplyAccumulate(accumulated.data(), source.data(), factor, length);
+            field.MultiplyAccumulate(tableAccumulated.data(), source.data(), table, length);
+            
+            if(region == expectedRegion && tableRegion == expectedRegion && accumulated == expectedAccumulated && tableAccumulated == expectedAccumulated)
+                numOfPassed++;
+        }
+        
+        Report(name + " regions", numOfPassed, 100);
+    }
+}
+
+// Bitsliced batches against ReedSolomon::Encode(). Batch sizes are not multiples of 8 and cover the 64 and 512
+// message planes, the messages of one batch have different lengths.
+void BitslicedMatchesEncode()
+{
+    constexpr std::array<uint64_t, 5> parityLengths{1, 2, 7, 16, 32};
+    constexpr std::array<uint64_t, 6> batchSizes{1, 7, 63, 65, 130, 517};
+    std::mt19937 rng(29);
+    uint64_t numOfCases = 0;
+    uint64_t numOfPassed = 0;
+    
+    for(const uint64_t nsym : parityLengths)
+    {
+        const ReedSolomon rs(8, nsym);
+        const BitslicedEncoder encoder(rs);
+        
+        for(const uint64_t batchSize : batchSizes)
+        {
+            numOfCases++;
+            
+            std::vector<std::vector<RSWord>> messages(batchSize);
+            for(std::vector<RSWord>& message : messages)
+                message = RandomMessage(1 + rng() % (255 - nsym), rng);
+            
+            const std::vector<std::vector<RSWord>> codewords = encoder.Encode(messages);
+            
+            bool passed = codewords.size() == batchSize;
+            for(uint64_t i = 0; passed && i < batchSize; i++)
+                passed = codewords[i] == rs.Encode(messages[i]);
+            
+            if(passed)
+                numOfPassed++;
+            else
+                std::cout << "  nsym " << nsym << ", batch size " << batchSize << std::endl;
+        }
+    }
+    
+    Report("Bitsliced encoder", numOfPassed, numOfCases);
+}
+
+// JIT kernel and its portable fallback against ReedSolomon::Encode(). Parity lengths around the 16 symbol
+// registers, messages of odd lengths and parity continued over split messages.
+void JitMatchesEncode()
+{
+    constexpr std::array<uint64_t, 7> parityLengths{1, 15, 16, 17, 33, JitEncoder::MaxNumOfErrorCorrectingSymbols, JitEncoder::MaxNumOfErrorCorrectingSymbols + 1};
+    constexpr uint64_t numOfCases = 20;
+    std::mt19937 rng(45);
+    
+    for(const bool allowJit : {true, false})
+    {
+        uint64_t numOfPassed = 0;
+        uint64_t numOfCompiled = 0;
+        
+        for(const uint64_t nsym : parityLengths)
+        {
+            const ReedSolomon rs(8, nsym);
+            const JitEncoder encoder(rs, allowJit);
+            numOfCompiled += encoder.IsCompiled() ? 1 : 0;
+            
+            for(uint64_t c = 0; c < numOfCases; c++)
+            {
+                const std::vector<RSWord> message = RandomMessage(1 + rng() % (255 - nsym), rng);
+                const std::vector<RSWord> expected = rs.Encode(message);
+                
+                // Parity of the message continued after a random split
+                const uint64_t split = rng() % (message.size() + 1);
+                std::vector<RSWord> parity(nsym, 0);
+                encoder.AccumulateParity(message.data(), split, parity.data());
+                encoder.AccumulateParity(message.data() + split, message.size() - split, parity.data());
+                
+                if(encoder.Encode(message) == expected && std::equal(parity.begin(), parity.end(), expected.begin() + static_cast<std::ptrdiff_t>(message.size())))
+                    numOfPassed++;
+                else
+                    std::cout << "  nsym " << nsym << ", message length " << message.size() << ", split " << split << std::endl;
+            }
+        }
+        
+        std::cout << "  " << numOfCompiled << " of " << parityLengths.size() << " encoders compiled" << std::endl;
+        Report(allowJit ? "JIT encoder" : "JIT encoder fallback", numOfPassed, numOfCases * parityLengths.size());
+    }
+}
+
+// Patched parity and syndromes against encoding and computing them from scratch, on messages shorter than the
+// maximum and with changes in the message as well as in the parity
+void IncrementalMatchesEncode()
+{
+    constexpr std::array<uint64_t, 4> parityLengths{1, 2, 8, 32};
+    constexpr uint64_t numOfCases = 50;
+    std::mt19937 rng(27);
+    uint64_t numOfPassed = 0;
+    
+    for(const uint64_t nsym : parityLengths)
+    {
+        const ReedSolomon rs(8, nsym);
+        const IncrementalEncoder encoder(rs);
+        
+        for(uint64_t c = 0; c < numOfCases; c++)
+        {
+            std::vector<RSWord> message = RandomMessage(1 + rng() % encoder.GetMaxMessageLength(), rng);
+            std::vector<RSWord> codeword = rs.Encode(message);
+            
+            // A range of the message through ModifyCodeword()
+            const uint64_t position = rng() % message.size();
+            const std::vector<RSWord> newData = RandomMessage(1 + rng() % (message.size() - position), rng);
+            std::ranges::copy(newData, message.begin() + static_cast<std::ptrdiff_t>(position));
+            encoder.ModifyCodeword(codeword, position, newData);
+            bool passed = codeword == rs.Encode(message);
+            
+            // A single symbol through UpdateParity()
+            const uint64_t symbolPosition = rng() % message.size();
+            const RSWord oldValue = message[symbolPosition];
+            message[symbolPosition] = static_cast<RSWord>(rng());
+            encoder.UpdateParity(codeword.data() + message.size(), message.size(), symbolPosition, oldValue, message[symbolPosition]);
+            codeword[symbolPosition] = message[symbolPosition];
+            passed = passed && codeword == rs.Encode(message);
+            
+            // Syndromes after changing any codeword symbols, parity included
+            std::vector<RSWord> syndromes(nsym);
+            rs.CalculateSyndromes(codeword.data(), codeword.size(), syndromes.data());
+            
+            const uint64_t changedPosition = rng() % codeword.size();
+            const std::vector<RSWord> changed = RandomMessage(1 + rng() % (codeword.size() - changedPosition), rng);
+            encoder.UpdateSyndromes(syndromes.data(), codeword.size(), changedPosition, codeword.data() + changedPosition, changed.data(), changed.size());
+            std::ranges::copy(changed, codeword.begin() + static_cast<std::ptrdiff_t>(changedPosition));
+            
+            std::vector<RSWord> expectedSyndromes(nsym);
+            rs.CalculateSyndromes(codeword.data(), codeword.size(), expectedSyndromes.data());
+            
+            if(passed && syndromes == expectedSyndromes)
+                numOfPassed++;
+            else
+                std::cout << "  nsym " << nsym << ", message length " << message.size() << std::endl;
+        }
+    }
+    
+    Report("Incremental encoder", numOfPassed, numOfCases * parityLengths.size());
+}
+
+// Syndromes accumulated from single symbols and fragments of odd sizes against CalculateSyndromes(), on both
+// backends, with one accumulator reset between codewords
+void SyndromeAccumulatorMatches()
+{
+    constexpr uint64_t numOfCases = 100;
+    std::mt19937 rng(42);
+    
+    for(const bool allowHardwareAcceleration : {true, false})
+    {
+        const GaloisField field(8, allowHardwareAcceleration);
+        uint64_t numOfPassed = 0;
+        
+        for(uint64_t c = 0; c < numOfCases; c++)
+        {
+            const uint64_t nsym = 1 + rng() % 64;
+            const ReedSolomon rs(field, nsym);
+            SyndromeAccumulator accumulator(rs);
+            
+            std::vector<RSWord> codeword = RandomCodeword(rs, nsym + 1 + rng() % (255 - nsym), rng);
+            if(c % 2 == 1)
+                Corrupt(codeword, RandomPositions(1 + rng() % nsym, codeword.size(), rng), rng);
+            
+            std::vector<RSWord> expected(nsym);
+            rs.CalculateSyndromes(codeword.data(), codeword.size(), expected.data());
+            const bool corrupted = std::ranges::any_of(expected, [](const RSWord s) { return s != 0; });
+            
+            // A previous codeword must not leak into this one
+            accumulator.Update(std::span<const RSWord>(codeword.data(), codeword.size() / 2));
+            accumulator.Reset();
+            
+            for(uint64_t offset = 0; offset < codeword.size();)
+            {
+                const uint64_t length = std::min<uint64_t>(rng() % 38, codeword.size() - offset);
+                
+                if(length == 0)
+                    accumulator.Update(codeword[offset++]);
+                else
+                    accumulator.Update(std::span<const RSWord>(codeword.data() + offset, length));
+                
+                offset += length;
+            }
+            
+            std::vector<RSWord> syndromes(nsym);
+            accumulator.GetSyndromes(syndromes.data());
+            
+            if(syndromes == expected && accumulator.IsCorrupted() == corrupted && accumulator.GetLength() == codeword.size())
+                numOfPassed++;
+        }
+        
+        Report(allowHardwareAcceleration ? "Syndrome accumulator" : "Syndrome accumulator (tables)", numOfPassed, numOfCases);
+    }
+}
+
+// CRC-32C check value of "123456789" on both kernels, and both kernels on random data continued at odd splits
+void CRC32CKernels()
+{
+    constexpr uint64_t numOfCases = 100;
+    constexpr std::string_view checkInput = "123456789";
+    constexpr uint32_t checkValue = 0xE3069283;
+    std::mt19937 rng(33);
+    
+    std::cout << "  kernel: " << (CRC32C::IsHardwareAccelerated() ? "SSE4.2" : "tables") << std::endl;
+    
+    const RSWord* const checkData = reinterpret_cast<const RSWord*>(checkInput.data());
+    const bool checked = CRC32C::Calculate(checkData, checkInput.size()) == checkValue && CRC32C::CalculatePortable(checkData, checkInput.size()) == checkValue;
+    Report("CRC-32C check value", checked ? 1 : 0, 1);
+    
+    uint64_t numOfPassed = 0;
+    
+    for(uint64_t c = 0; c < numOfCases; c++)
+    {
+        const std::vector<RSWord> data = RandomMessage(rng() % 1000, rng);
+        const uint64_t split = rng() % (data.size() + 1);
+        
+        const uint32_t crc = CRC32C::Calculate(data.data(), data.size());
+        const uint32_t continued = CRC32C::Calculate(data.data() + split, data.size() - split, CRC32C::Calculate(data.data(), split));
+        const uint32_t portable = CRC32C::CalculatePortable(data.data() + split, data.size() - split, CRC32C::CalculatePortable(data.data(), split));
+        
+        if(crc == continued && crc == portable)
+            numOfPassed++;
+    }
+    
+    Report("CRC-32C kernels", numOfPassed, numOfCases);
+}
+}
+
+int main()
+{
+    LongCodesWithHeavyErasures();
+    ErrorsOnly();
+    ErasuresOnly();
+    InvalidParameters();
+    DecodeInPlaceCorrections();
+    ScatterGather();
+    MemoryResourcePaths();
+    CodecServicePaths();
+    RateCompatibleParityLengths();
+    SubBlockChecksums();
+    ContainerRoundTrips();
+    ProductCodeBursts();
+    AsyncCodecPaths();
+    GfniMatchesTables();
+    AdditiveFFTRoundTrips();
+    TowerFieldChecks();
+    BitslicedMatchesEncode();
+    JitMatchesEncode();
+    IncrementalMatchesEncode();
+    SyndromeAccumulatorMatches();
+    CRC32CKernels();
+    
+    return g_NumOfFailures == 0 ? 0 : 1;
+}
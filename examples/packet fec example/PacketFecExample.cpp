@@ -0,0 +1,201 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  PacketFecExample.cpp                                            */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#include "ReedSolomon.hpp"
+#include <random>
+
+// Using namespace for ReedSolomon lib
+using namespace RS;
+
+// Loopback over a simulated lossy channel: every packet is serialized, dropped or passed on, parsed and fed to the
+// decoder. Loss patterns within the repair capacity must be recovered completely, random burst loss only reports
+// the recovery rate. Every delivered payload must match the sent one. Returns a nonzero exit code on failure,
+// the example is also registered as test.
+
+namespace
+{
+uint64_t g_NumOfFailures = 0;
+
+struct LoopbackResult
+{
+    uint64_t            numOfDelivered = 0;
+    uint64_t            numOfRecovered = 0;
+    uint64_t            numOfWrongPayloads = 0; // Differing from the sent payload or delivered twice
+    PacketFecStatistics statistics;
+};
+
+// Sends numOfPackets payloads of random length, drop decides for every packet whether the channel loses it
+LoopbackResult RunLoopback(const PacketFecSettings& settings, const uint64_t numOfPackets, const std::function<bool(const FecPacket&)>& drop, std::mt19937& rng)
+{
+    PacketFecEncoder encoder(settings);
+    PacketFecDecoder decoder(settings);
+    
+    std::vector<std::vector<RSWord>> sent;
+    std::vector<bool> isDelivered;
+    LoopbackResult result;
+    
+    const auto transmit = [&](const std::vector<FecPacket>& packets)
+    {
+        for(const FecPacket& packet : packets)
+        {
+            if(drop(packet))
+                continue;
+            
+            for(const FecDeliveredPacket& delivered : decoder.Receive(FecPacket::Parse(packet.Serialize())))
+            {
+                if(delivered.sequence >= sent.size() || delivered.payload != sent[delivered.sequence] || isDelivered[delivered.sequence])
+                {
+                    result.numOfWrongPayloads++;
+                    continue;
+                }
+                
+                isDelivered[delivered.sequence] = true;
+                result.numOfDelivered++;
+                result.numOfRecovered += delivered.recovered ? 1 : 0;
+            }
+        }
+    };
+    
+    for(uint64_t i = 0; i < numOfPackets; i++)
+    {
+        std::vector<RSWord> payload(rng() % 1200);
+        for(RSWord& symbol : payload)
+            symbol = static_cast<RSWord>(rng());
+        
+        sent.push_back(payload);
+        isDelivered.push_back(false);
+        
+        transmit(encoder.Push(payload));
+    }
+    
+    transmit(encoder.Flush());
+    
+    result.statistics = decoder.GetStatistics();
+    
+    return result;
+}
+
+void Report(const std::string& name, const LoopbackResult& result, const uint64_t numOfPackets, const bool mustDeliverAll)
+{
+    const bool passed = result.numOfWrongPayloads == 0 && (!mustDeliverAll || result.numOfDelivered == numOfPackets);
+    
+    std::cout << (passed ? "PASS " : "FAIL ") << name << ": " << result.numOfDelivered << "/" << numOfPackets << " delivered, "
+              << result.numOfRecovered << " recovered, " << result.numOfWrongPayloads << " wrong, "
+              << result.statistics.windowsFailed << " failed windows" << std::endl;
+    
+    if(!passed)
+        g_NumOfFailures++;
+}
+
+// Block mode, every window of K source and M repair packets loses up to M of them
+void BlockModeBoundedLoss()
+{
+    constexpr PacketFecSettings settings{16, 4, 0};
+    constexpr uint64_t numOfPackets = 100 * settings.numOfSourcePackets;
+    constexpr uint64_t windowSize = settings.numOfSourcePackets + settings.numOfRepairPackets;
+    
+    std::mt19937 rng(43);
+    uint64_t packetIndex = 0;
+    std::vector<bool> isLost(windowSize);
+    
+    const LoopbackResult result = RunLoopback(settings, numOfPackets, [&](const FecPacket&)
+    {
+        // New window: choose up to M lost packets of it
+        if(packetIndex % windowSize == 0)
+        {
+            isLost.assign(windowSize, false);
+            
+            const uint64_t numOfLost = rng() % (settings.numOfRepairPackets + 1);
+            for(uint64_t i = 0; i < numOfLost; i++)
+                isLost[rng() % windowSize] = true;
+        }
+        
+        return isLost[packetIndex++ % windowSize];
+    }, rng);
+    
+    Report("Block mode, up to M losses per window", result, numOfPackets, true);
+}
+
+// Sliding mode, at most one of every 8 consecutive source packets and up to 2 of every M repair packets are lost,
+// so every window of K = 16 source packets misses at most 2 of them and keeps at least 2 repairs
+void SlidingModeBoundedLoss()
+{
+    constexpr PacketFecSettings settings{16, 4, 4};
+    constexpr uint64_t numOfPackets = 1600;
+    
+    std::mt19937 rng(44);
+    uint64_t lostOffset = 0;
+    
+    const LoopbackResult result = RunLoopback(settings, numOfPackets, [&](const FecPacket& packet)
+    {
+        if(packet.isRepair)
+            return packet.repairIndex < 2 && rng() % 2 == 0;
+        
+        if(packet.sequence % 8 == 0)
+            lostOffset = rng() % 16; // Half of the groups lose nothing
+        
+        return packet.sequence % 8 == lostOffset;
+    }, rng);
+    
+    Report("Sliding mode, bounded losses", result, numOfPackets, true);
+}
+
+// Gilbert-Elliott channel: 1% loss in the good state, 50% in bursts. Not everything can be recovered,
+// but no wrong payload may be delivered.
+void RandomBurstLoss(const std::string& name, const PacketFecSettings& settings)
+{
+    constexpr uint64_t numOfPackets = 5000;
+    
+    std::mt19937 rng(45);
+    bool isBurst = false;
+    
+    const LoopbackResult result = RunLoopback(settings, numOfPackets, [&](const FecPacket&)
+    {
+        isBurst = isBurst ? rng() % 100 >= 25 : rng() % 100 < 2;
+        
+        return rng() % 100 < (isBurst ? 50U : 1U);
+    }, rng);
+    
+    Report(name, result, numOfPackets, false);
+}
+}
+
+int main()
+{
+    BlockModeBoundedLoss();
+    SlidingModeBoundedLoss();
+    RandomBurstLoss("Block mode, burst loss", {16, 4, 0});
+    RandomBurstLoss("Sliding mode, burst loss", {16, 4, 4});
+    
+    return g_NumOfFailures == 0 ? 0 : 1;
+}
@@ -0,0 +1,103 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  AdaptiveProtection.hpp                                          */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#ifndef AdaptiveProtection_hpp
+#define AdaptiveProtection_hpp
+
+namespace NReedSolomon
+{
+struct AdaptiveProtectionSettings
+{
+    uint64_t    minNumOfErrorCorrectingSymbols = 2;
+    uint64_t    maxNumOfErrorCorrectingSymbols = 32;
+    double      targetFailureProbability = 1e-6;    // Per codeword
+    uint64_t    windowSize = 256;                   // Decoded codewords the statistics are taken over
+};
+
+struct AdaptiveProtectionStatistics
+{
+    uint64_t    numOfCodewords = 0;     // In the window
+    uint64_t    numOfSymbols = 0;
+    uint64_t    numOfErrors = 0;        // Corrected errors, a failure counts as nsym / 2 + 1
+    uint64_t    numOfFailures = 0;
+    double      symbolErrorRate = 0.0;
+};
+
+// Chooses the parity length of one stream from its decoding results.
+// The symbol error rate is estimated over a moving window of codewords as (errors + 1) / (symbols + 1), the
+// added error keeps a short or clean window from claiming a perfect channel. With errors modeled as independent,
+// a codeword of n symbols and nsym parity fails if more than nsym / 2 of its symbols are wrong, so the
+// recommendation is the smallest nsym whose binomial tail P(X > nsym / 2) stays under the target.
+// Thread-safe, the decoding side records while the encoding side asks for the parity length.
+class AdaptiveProtectionController
+{
+    struct Observation
+    {
+        uint64_t    numOfSymbols = 0;
+        uint64_t    numOfErrors = 0;
+        bool        failed = false;
+    };
+    
+    const AdaptiveProtectionSettings    m_Settings;
+    
+    mutable std::mutex                  m_Mutex;
+    std::deque<Observation>             m_Window;
+    AdaptiveProtectionStatistics        m_Statistics;
+    
+    void Record(const Observation& observation);
+    [[nodiscard]] double GetSymbolErrorRate() const;
+    
+public:
+    explicit AdaptiveProtectionController(const AdaptiveProtectionSettings& settings = {});
+    
+    // Successful decode of a codeword of codewordLength symbols (numOfErrorsFound as returned by Decode)
+    void RecordDecode(uint64_t codewordLength, uint64_t numOfErrorsFound);
+    
+    // Decoding failed, the codeword had more than nsym / 2 errors
+    void RecordFailure(uint64_t codewordLength, uint64_t numOfErrorCorrectingSymbols);
+    
+    // Smallest parity length within the settings that keeps the estimated failure probability under the target,
+    // the maximum if none does
+    [[nodiscard]] uint64_t Recommend(uint64_t messageLength) const;
+    
+    [[nodiscard]] double EstimateFailureProbability(uint64_t messageLength, uint64_t numOfErrorCorrectingSymbols) const;
+    
+    [[nodiscard]] AdaptiveProtectionStatistics GetStatistics() const;
+    void Reset();
+    
+    // Probability that more than numOfCorrectableErrors of n symbols are wrong, each independently with symbolErrorRate
+    [[nodiscard]] static double CalculateFailureProbability(uint64_t n, uint64_t numOfCorrectableErrors, double symbolErrorRate);
+};
+}
+
+#endif /* AdaptiveProtection_hpp */
@@ -0,0 +1,99 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  AdditiveFFTCodec.hpp                                            */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#ifndef AdditiveFFTCodec_hpp
+#define AdditiveFFTCodec_hpp
+
+namespace NReedSolomon
+{
+using RSWord16 = uint16_t; // Symbol of the GF(2^16) codecs
+
+// Systematic Reed-Solomon erasure code over the GF(2^16) of TowerField with O(n log n) encoding and
+// decoding, for codewords of up to 65536 symbols with thousands of parity symbols where the O(n * nsym) long
+// division of ReedSolomon gets too slow.
+//
+// Codewords are the values of a polynomial at the points omega_i = i, i.e. on additive subspaces of the field.
+// Polynomials are kept in the novel polynomial basis of Lin, Chung and Han, in which the additive FFT over a
+// subspace of size 2^r needs r layers of n / 2 butterflies.
+//   Encoding: the message is split into chunks of m = 2^ceil(log2(nsym)) symbols, each chunk costs one inverse
+//             FFT of size m and the parity one FFT of size m, so the cost per symbol grows with log(nsym) only.
+//   Decoding: the erasure locator is evaluated at all points at once by a Walsh-Hadamard transform of its
+//             logarithms, the erased symbols follow from the formal derivative of (codeword * locator) with
+//             one FFT pair of the transform size n = 2^ceil(log2(m + messageLength)).
+//
+// Only erasures are corrected (up to nsym per codeword), there is no syndrome check for unknown errors.
+// Like ReedSolomon::Encode() a codeword is the message followed by its parity.
+class AdditiveFFTCodec
+{
+    static constexpr uint64_t FieldBits = 16;
+    
+    const uint64_t  m_MessageLength = 0;
+    const uint64_t  m_NumOfErrorCorrectingSymbols = 0;
+    uint64_t        m_ChunkSize = 0;        // m, parity chunk at point 0, message chunk i at point (i + 1) * m
+    uint64_t        m_TransformSize = 0;    // n, power of two covering all chunks
+    
+    // Normalized subspace polynomials at the basis points, m_Skews[j][b] = s_j(2^b) / s_j(2^j)
+    std::array<std::array<RSWord16, FieldBits>, FieldBits> m_Skews{};
+    std::array<RSWord16, FieldBits> m_DerivativeFactors{};  // (s_j(x) / s_j(2^j))' is a constant
+    AlignedVector<uint32_t> m_LogWalsh;                     // Walsh-Hadamard transform of log(omega_i), i < n
+    
+    void PrecomputeTables();
+    
+    [[nodiscard]] RSWord16 GetSkew(uint64_t layer, uint64_t point) const;
+    
+    // Novel basis coefficients <-> values at the points offset .. offset + size - 1 (offset is a multiple of size)
+    void FFT(RSWord16*data, uint64_t size, uint64_t offset) const;
+    void IFFT(RSWord16*data, uint64_t size, uint64_t offset) const;
+    void FormalDerivative(const RSWord16*coefficients, RSWord16*derivative, uint64_t size) const;
+    
+public:
+    static constexpr uint64_t MaxCodewordLength = uint64_t(1) << FieldBits;
+    
+    AdditiveFFTCodec(uint64_t messageLength, uint64_t numOfErrorCorrectingSymbols);
+    
+    [[nodiscard]] std::vector<RSWord16> Encode(std::span<const RSWord16> message) const;
+    
+    // Allocation light encoder, writes the error correction symbols of message into parity
+    void CalculateParity(const RSWord16*message, RSWord16*parity) const;
+    
+    // Restores the erased symbols of the codeword in place. Erasure positions must be distinct.
+    void DecodeErasures(std::span<RSWord16> codeword, const std::vector<uint64_t>& erasurePositions) const;
+    
+    [[nodiscard]] uint64_t GetMessageLength() const noexcept { return m_MessageLength; }
+    [[nodiscard]] uint64_t GetNumberOfErrorCorrectingSymbols() const noexcept { return m_NumOfErrorCorrectingSymbols; }
+    [[nodiscard]] uint64_t GetCodewordLength() const noexcept { return m_MessageLength + m_NumOfErrorCorrectingSymbols; }
+    [[nodiscard]] uint64_t GetTransformSize() const noexcept { return m_TransformSize; }
+};
+}
+
+#endif /* AdditiveFFTCodec_hpp */
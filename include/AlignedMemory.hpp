@@ -0,0 +1,113 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  AlignedMemory.hpp                                               */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#ifndef AlignedMemory_hpp
+#define AlignedMemory_hpp
+
+namespace NReedSolomon
+{
+constexpr uint64_t CacheLineSize = 64;
+
+// Allocator for lookup tables: the first element starts a cache line, so no entry of a table
+// smaller than a cache line is split and full vector loads from the start are aligned
+template <typename T>
+class AlignedAllocator
+{
+public:
+    using value_type = T;
+    
+    AlignedAllocator() noexcept = default;
+    
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U>&) noexcept {} // NOLINT(*-explicit-constructor)
+    
+    [[nodiscard]] T* allocate(const std::size_t n)
+    {
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(CacheLineSize)));
+    }
+    
+    void deallocate(T* const p, const std::size_t) noexcept
+    {
+        ::operator delete(p, std::align_val_t(CacheLineSize));
+    }
+    
+    template <typename U>
+    bool operator==(const AlignedAllocator<U>&) const noexcept { return true; }
+};
+
+template <typename T>
+using AlignedVector = std::vector<T, AlignedAllocator<T>>;
+
+enum class PageMode
+{
+    Default,                // Regular pages
+    TransparentHugePages,   // 2 MiB aligned mapping with MADV_HUGEPAGE, the kernel backs it with huge pages if it can
+    ExplicitHugePages       // MAP_HUGETLB from the reserved pool (vm.nr_hugepages), falls back to transparent huge pages
+};
+
+// Equally sized buffers carved from one mapping, for the large encode/decode buffers of pipelines and
+// batch workers: one huge page replaces 512 TLB entries of 4 KiB pages. The memory can also back a
+// std::pmr::monotonic_buffer_resource (GetData(), GetSize()).
+// Huge pages are only available on Linux, elsewhere (and if the kernel refuses) regular pages are used.
+class BufferPool
+{
+    RSWord*     m_Memory = nullptr;
+    uint64_t    m_Size = 0;
+    uint64_t    m_NumOfBuffers = 0;
+    uint64_t    m_BufferSize = 0;   // Stride, a multiple of the alignment
+    uint64_t    m_Alignment = 0;
+    PageMode    m_PageMode = PageMode::Default; // Mode in effect
+    
+    bool Map(PageMode pageMode);
+    
+public:
+    static constexpr uint64_t PageSize = 4096;
+    static constexpr uint64_t HugePageSize = 2 * 1024 * 1024;
+    
+    // Every buffer starts at a multiple of alignment (a power of two, at most PageSize)
+    BufferPool(uint64_t numOfBuffers, uint64_t bufferSize, PageMode pageMode = PageMode::TransparentHugePages, uint64_t alignment = CacheLineSize);
+    BufferPool(const BufferPool&) = delete;
+    BufferPool& operator=(const BufferPool&) = delete;
+    ~BufferPool();
+    
+    [[nodiscard]] RSWord* GetBuffer(uint64_t index) const;
+    
+    [[nodiscard]] RSWord* GetData() const noexcept { return m_Memory; }
+    [[nodiscard]] uint64_t GetSize() const noexcept { return m_Size; }
+    [[nodiscard]] uint64_t GetNumberOfBuffers() const noexcept { return m_NumOfBuffers; }
+    [[nodiscard]] uint64_t GetBufferSize() const noexcept { return m_BufferSize; }
+    [[nodiscard]] PageMode GetPageMode() const noexcept { return m_PageMode; }
+};
+}
+
+#endif /* AlignedMemory_hpp */
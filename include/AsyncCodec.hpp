@@ -0,0 +1,284 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  AsyncCodec.hpp                                                  */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#ifndef AsyncCodec_hpp
+#define AsyncCodec_hpp
+
+namespace NReedSolomon
+{
+// Runs a unit of work somewhere else (thread pool, io_context, ...)
+using AsyncExecutor = std::function<void(std::function<void()>)>;
+
+// Lazily started coroutine with a single awaiter, which is resumed when the task completes
+template <typename T>
+class AsyncTask
+{
+public:
+    struct promise_type
+    {
+        std::optional<T>        value;
+        std::exception_ptr      error;
+        std::coroutine_handle<> continuation = std::noop_coroutine();
+        
+        struct FinalAwaiter
+        {
+            [[nodiscard]] bool await_ready() const noexcept { return false; }
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) noexcept { return handle.promise().continuation; }
+            void await_resume() const noexcept {}
+        };
+        
+        AsyncTask get_return_object() { return AsyncTask(std::coroutine_handle<promise_type>::from_promise(*this)); }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        FinalAwaiter final_suspend() noexcept { return {}; }
+        void return_value(T result) { value = std::move(result); }
+        void unhandled_exception() noexcept { error = std::current_exception(); }
+    };
+    
+private:
+    std::coroutine_handle<promise_type> m_Handle;
+    
+    explicit AsyncTask(const std::coroutine_handle<promise_type> handle) : m_Handle(handle) {}
+    
+public:
+    AsyncTask(AsyncTask&& other) noexcept : m_Handle(std::exchange(other.m_Handle, nullptr)) {}
+    AsyncTask& operator=(AsyncTask&&) = delete;
+    AsyncTask(const AsyncTask&) = delete;
+    AsyncTask& operator=(const AsyncTask&) = delete;
+    
+    ~AsyncTask()
+    {
+        if(m_Handle)
+            m_Handle.destroy();
+    }
+    
+    // Awaiting starts the task
+    [[nodiscard]] bool await_ready() const noexcept { return false; }
+    
+    std::coroutine_handle<> await_suspend(const std::coroutine_handle<> caller) noexcept
+    {
+        m_Handle.promise().continuation = caller;
+        return m_Handle;
+    }
+    
+    T await_resume()
+    {
+        if(m_Handle.promise().error)
+            std::rethrow_exception(m_Handle.promise().error);
+        
+        return std::move(*m_Handle.promise().value);
+    }
+};
+
+// Coroutine producing values asynchronously: co_await Next() runs it up to its next co_yield,
+// an empty optional marks the end
+template <typename T>
+class AsyncGenerator
+{
+public:
+    struct promise_type
+    {
+        std::optional<T>        current;
+        std::exception_ptr      error;
+        std::coroutine_handle<> consumer = std::noop_coroutine();
+        
+        // Hands control back to the consumer after a co_yield and at the end
+        struct ConsumerAwaiter
+        {
+            [[nodiscard]] bool await_ready() const noexcept { return false; }
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) noexcept { return handle.promise().consumer; }
+            void await_resume() const noexcept {}
+        };
+        
+        AsyncGenerator get_return_object() { return AsyncGenerator(std::coroutine_handle<promise_type>::from_promise(*this)); }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        ConsumerAwaiter final_suspend() noexcept { return {}; }
+        
+        ConsumerAwaiter yield_value(T value)
+        {
+            current = std::move(value);
+            return {};
+        }
+        
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { error = std::current_exception(); }
+    };
+    
+private:
+    std::coroutine_handle<promise_type> m_Handle;
+    
+    explicit AsyncGenerator(const std::coroutine_handle<promise_type> handle) : m_Handle(handle) {}
+    
+public:
+    AsyncGenerator(AsyncGenerator&& other) noexcept : m_Handle(std::exchange(other.m_Handle, nullptr)) {}
+    AsyncGenerator& operator=(AsyncGenerator&&) = delete;
+    AsyncGenerator(const AsyncGenerator&) = delete;
+    AsyncGenerator& operator=(const AsyncGenerator&) = delete;
+    
+    ~AsyncGenerator()
+    {
+        if(m_Handle)
+            m_Handle.destroy();
+    }
+    
+    struct NextAwaiter
+    {
+        std::coroutine_handle<promise_type> handle;
+        
+        [[nodiscard]] bool await_ready() const noexcept { return handle.done(); }
+        
+        std::coroutine_handle<> await_suspend(const std::coroutine_handle<> consumer) noexcept
+        {
+            handle.promise().consumer = consumer;
+            handle.promise().current.reset();
+            return handle;
+        }
+        
+        std::optional<T> await_resume()
+        {
+            if(handle.promise().error)
+                std::rethrow_exception(std::exchange(handle.promise().error, nullptr));
+            
+            return std::exchange(handle.promise().current, std::nullopt);
+        }
+    };
+    
+    [[nodiscard]] NextAwaiter Next() { return {m_Handle}; }
+};
+
+// Blocks the calling thread until the task completed, for callers outside of coroutines
+template <typename T>
+T SyncWait(AsyncTask<T> task);
+
+// Coroutine front end for a shared codec. Large jobs are split into steps of whole codewords of about
+// chunkSize bytes, the steps run on the executor and the awaiting coroutine is resumed once the last step
+// finished: on the resume executor if one is given (e.g. the reactor's post()), otherwise on that worker.
+// The codec object must outlive all operations started on it.
+class AsyncCodec
+{
+    const std::shared_ptr<const ReedSolomon>    m_Codec;
+    const AsyncExecutor                         m_Executor;
+    const AsyncExecutor                         m_ResumeExecutor;
+    const uint64_t                              m_ChunkSize = 0;
+    
+    // Runs function(step) for every step < numOfSteps on the executor
+    class ParallelSteps
+    {
+        const AsyncCodec*                   m_AsyncCodec = nullptr;
+        const uint64_t                      m_NumOfSteps = 0;
+        std::function<void(uint64_t)>       m_Function;
+        
+        std::atomic<uint64_t>               m_Remaining = 0;
+        std::atomic<bool>                   m_HasError = false;
+        std::exception_ptr                  m_Error;
+        
+        void SetError(std::exception_ptr error);
+        
+        // The call finishing the last of all steps resumes the coroutine
+        void FinishSteps(uint64_t numOfSteps, std::coroutine_handle<> handle);
+    
+    public:
+        ParallelSteps(const AsyncCodec* asyncCodec, uint64_t numOfSteps, std::function<void(uint64_t)> function);
+        
+        [[nodiscard]] bool await_ready() const noexcept { return m_NumOfSteps == 0; }
+        void await_suspend(std::coroutine_handle<> handle);
+        void await_resume() const;
+    };
+    
+    [[nodiscard]] uint64_t GetCodewordsPerStep(uint64_t codewordLength) const;
+    
+public:
+    static constexpr uint64_t DefaultChunkSize = 64 * 1024;
+    
+    AsyncCodec(std::shared_ptr<const ReedSolomon> codec, AsyncExecutor executor, AsyncExecutor resumeExecutor = {}, uint64_t chunkSize = DefaultChunkSize);
+    
+    AsyncCodec(const AsyncCodec&) = delete;
+    AsyncCodec& operator=(const AsyncCodec&) = delete;
+    
+    // Executor submitting to a thread pool, which must outlive the codec
+    [[nodiscard]] static AsyncExecutor MakeExecutor(ThreadPool& threadPool);
+    
+    // Splits data into messages of messageLength (the last one may be shorter), returns the codewords back to back
+    [[nodiscard]] AsyncTask<std::vector<RSWord>> Encode(std::vector<RSWord> data, uint64_t messageLength) const;
+    
+    // Inverse of Encode(), the first codeword that cannot be corrected throws
+    [[nodiscard]] AsyncTask<DecodeResult> Decode(std::vector<RSWord> codewords, uint64_t messageLength) const;
+    
+    // Streaming Decode(): yields the messages of one step as soon as it is decoded
+    [[nodiscard]] AsyncGenerator<std::vector<RSWord>> DecodeChunks(std::vector<RSWord> codewords, uint64_t messageLength) const;
+    
+    [[nodiscard]] const ReedSolomon& GetCodec() const noexcept { return *m_Codec; }
+};
+
+namespace Detail
+{
+    // Fire and forget coroutine driving SyncWait()
+    struct DetachedTask
+    {
+        struct promise_type
+        {
+            DetachedTask get_return_object() noexcept { return {}; }
+            std::suspend_never initial_suspend() noexcept { return {}; }
+            std::suspend_never final_suspend() noexcept { return {}; }
+            void return_void() noexcept {}
+            void unhandled_exception() noexcept { std::terminate(); }
+        };
+    };
+    
+    // The promise lives in the coroutine frame, so it is not destroyed while the result is being set
+    template <typename T>
+    DetachedTask RunAndSignal(AsyncTask<T> task, std::promise<T> result)
+    {
+        try
+        {
+            result.set_value(co_await task);
+        }
+        catch(...)
+        {
+            result.set_exception(std::current_exception());
+        }
+    }
+}
+
+template <typename T>
+T SyncWait(AsyncTask<T> task)
+{
+    std::promise<T> result;
+    std::future<T> future = result.get_future();
+    
+    Detail::RunAndSignal(std::move(task), std::move(result));
+    
+    return future.get();
+}
+}
+
+#endif /* AsyncCodec_hpp */
@@ -0,0 +1,100 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  AsyncFilePipeline.hpp                                           */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#ifndef AsyncFilePipeline_hpp
+#define AsyncFilePipeline_hpp
+
+namespace NReedSolomon
+{
+struct AsyncFilePipelineSettings
+{
+    uint64_t    queueDepth = 32;    // Chunk buffers, each one is being read, computed or written
+    uint64_t    numOfThreads = 0;   // Zero selects std::thread::hardware_concurrency()
+    bool        directIo = false;   // O_DIRECT reads, the protect chunk size must be a multiple of Alignment
+    PageMode    pageMode = PageMode::Default; // Pages backing the chunk buffers
+};
+
+// Protects files into containers and verifies containers without blocking on disk:
+// one thread keeps queueDepth aligned reads and writes in flight on an io_uring, while the workers
+// encode or decode the chunks that have been read. Chunk buffers come from a fixed pool and are recycled
+// once their write completed. Container writes are buffered, the 96 byte header keeps chunks unaligned.
+//
+// Without io_uring (other platforms, old kernels, seccomp) and for chunks too large for a single request
+// the same results are produced with ContainerWriter and ContainerReader.
+class AsyncFilePipeline
+{
+    // Chunk buffer of the pool
+    struct Slot
+    {
+        RSWord*             input = nullptr;    // Buffers of the run's BufferPool
+        RSWord*             output = nullptr;
+        uint64_t            chunkIndex = 0;
+        uint64_t            bufferOffset = 0;   // Start of the chunk in the input buffer (aligned reads)
+        uint64_t            ioLength = 0;       // Bytes the current read or write must transfer
+        bool                isWriting = false;
+        bool                needsWrite = false;
+        std::exception_ptr  error;
+    };
+    
+    // Stages of one chunk, the compute stage runs on the thread pool
+    struct Stages
+    {
+        std::function<void(IoUring&, Slot&, uint64_t userData)> read;
+        std::function<bool(Slot&)>                              compute; // Returns true if the chunk must be written
+        std::function<void(IoUring&, Slot&, uint64_t userData)> write;
+    };
+    
+    const AsyncFilePipelineSettings m_Settings;
+    ThreadPool                      m_ThreadPool;
+    
+    void Run(uint64_t numOfChunks, std::vector<Slot>& slots, const Stages& stages);
+    
+public:
+    static constexpr uint64_t Alignment = 4096;
+    
+    explicit AsyncFilePipeline(const AsyncFilePipelineSettings& settings = {});
+    
+    AsyncFilePipeline(const AsyncFilePipeline&) = delete;
+    AsyncFilePipeline& operator=(const AsyncFilePipeline&) = delete;
+    
+    [[nodiscard]] static bool IsSupported() { return IoUring::IsSupported(); }
+    
+    // Writes the content of input as container file output
+    ContainerHeader Protect(const std::filesystem::path& input, const std::filesystem::path& output, const ReedSolomon& reedSolomon, uint64_t chunkSize = ContainerWriter::DefaultChunkSize, ContainerLayout layout = ContainerLayout::Interleaved, bool chunkChecksums = false);
+    
+    // Verifies every chunk of a container, optionally repairing it in place
+    ContainerScrubReport Verify(const std::filesystem::path& container, bool repair = false);
+};
+}
+
+#endif /* AsyncFilePipeline_hpp */
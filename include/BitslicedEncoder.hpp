@@ -0,0 +1,78 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  BitslicedEncoder.hpp                                            */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#ifndef BitslicedEncoder_hpp
+#define BitslicedEncoder_hpp
+
+namespace NReedSolomon
+{
+// Encodes many messages at once. The messages are transposed into bit planes (bit b of every message's
+// current symbol in one machine word) and the parity LFSR runs on those planes with XOR only:
+// multiplying by a constant generator coefficient is a fixed 8x8 bit matrix, compiled into an XOR schedule.
+//
+// Small batches use 64-bit planes, larger ones 512-bit planes (8 x 64 bit, vectorized by the compiler).
+// Messages of different length are left padded with zeros, which does not change their parity.
+class BitslicedEncoder
+{
+    // Output bit plane ^= input bit plane
+    struct XorTerm
+    {
+        uint8_t outputBit = 0;
+        uint8_t inputBit = 0;
+    };
+    
+    const ReedSolomon*      m_ReedSolomon = nullptr;
+    const uint64_t          m_BitsPerWord = 0;
+    const uint64_t          m_NumOfErrorCorrectingSymbols = 0;
+    
+    std::vector<XorTerm>    m_Schedule;         // Terms of all generator coefficients, back to back
+    std::vector<uint64_t>   m_ScheduleOffsets;  // Coefficient j uses terms [offset[j], offset[j + 1])
+    
+    void CompileSchedule();
+    
+    template <uint64_t Words>
+    void EncodeBatch(const std::vector<RSWord>*const*messages, uint64_t numOfMessages, uint64_t length, RSWord*const*parities) const;
+    
+public:
+    static constexpr uint64_t MessagesPerWord = 64;
+    
+    explicit BitslicedEncoder(const ReedSolomon& reedSolomon);
+    
+    // Same result as calling ReedSolomon::Encode() on every message
+    [[nodiscard]] std::vector<std::vector<RSWord>> Encode(const std::vector<std::vector<RSWord>>& messages) const;
+    
+    [[nodiscard]] uint64_t GetNumberOfXorTerms() const noexcept { return m_Schedule.size(); }
+};
+}
+
+#endif /* BitslicedEncoder_hpp */
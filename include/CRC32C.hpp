@@ -0,0 +1,60 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  CRC32C.hpp                                                      */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#ifndef CRC32C_hpp
+#define CRC32C_hpp
+
+// Hardware kernel uses the SSE4.2 CRC32 instruction, selected at runtime after a CPUID check
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+    #define RS_CRC32C_KERNELS 1
+#else
+    #define RS_CRC32C_KERNELS 0
+#endif
+
+namespace NReedSolomon
+{
+// CRC-32C (Castagnoli), used as fast checksum in front of the syndrome computation:
+// it runs at a few bytes per cycle and a match lets clean data skip the GF(2^8) arithmetic.
+namespace CRC32C
+{
+    [[nodiscard]] bool IsHardwareAccelerated();
+    
+    // Continues crc over data, start with crc = 0
+    [[nodiscard]] uint32_t Calculate(const RSWord*data, uint64_t length, uint32_t crc = 0);
+    
+    // Same with the slicing-by-8 table kernel on every CPU, which Calculate() uses without SSE4.2
+    [[nodiscard]] uint32_t CalculatePortable(const RSWord*data, uint64_t length, uint32_t crc = 0);
+}
+}
+
+#endif /* CRC32C_hpp */
@@ -0,0 +1,134 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  CodecService.hpp                                                */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#ifndef CodecService_hpp
+#define CodecService_hpp
+
+namespace NReedSolomon
+{
+// Scratch memory reused by one decode/encode at a time
+struct CodecWorkspace
+{
+    std::vector<RSWord> syndromes;
+    std::vector<RSWord> codeword;   // Capacity of the longest codeword, corrupt codewords are corrected in here
+};
+
+// Lock-free pool of workspaces. A thread claims a free slot with a single atomic exchange,
+// starting the search at a slot derived from its thread id so threads rarely collide.
+class WorkspacePool
+{
+    struct alignas(64) Slot // One cache line per flag to avoid false sharing
+    {
+        std::atomic<bool>   m_InUse = false;
+        CodecWorkspace      m_Workspace;
+    };
+    
+    const uint64_t          m_NumOfSlots = 0;
+    const uint64_t          m_NumOfErrorCorrectingSymbols = 0;
+    const uint64_t          m_MaxCodewordLength = 0;
+    std::unique_ptr<Slot[]> m_Slots;
+    
+    void InitializeWorkspace(CodecWorkspace& workspace) const;
+    
+public:
+    // RAII handle, returns the workspace to the pool on destruction
+    class Lease
+    {
+        friend class WorkspacePool;
+        
+        Slot*                           m_Slot = nullptr;
+        std::unique_ptr<CodecWorkspace> m_Overflow; // Used if all slots are taken
+        
+        explicit Lease(Slot* slot) : m_Slot(slot) {}
+        explicit Lease(std::unique_ptr<CodecWorkspace> overflow) : m_Overflow(std::move(overflow)) {}
+    
+    public:
+        Lease(Lease&& other) noexcept;
+        Lease& operator=(Lease&&) = delete;
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+        ~Lease();
+        
+        CodecWorkspace& operator*() const noexcept { return m_Slot ? m_Slot->m_Workspace : *m_Overflow; }
+        CodecWorkspace* operator->() const noexcept { return &**this; }
+    };
+    
+    WorkspacePool(uint64_t numOfSlots, uint64_t numOfErrorCorrectingSymbols, uint64_t maxCodewordLength);
+    
+    WorkspacePool(const WorkspacePool&) = delete;
+    WorkspacePool& operator=(const WorkspacePool&) = delete;
+    
+    [[nodiscard]] Lease Acquire();
+    [[nodiscard]] uint64_t GetNumberOfSlots() const noexcept { return m_NumOfSlots; }
+};
+
+struct DecodeResult
+{
+    std::vector<RSWord> message;
+    uint64_t            numOfErrorsFound = 0;
+};
+
+// Thread-safe front end for one shared, read-only ReedSolomon codec.
+// Encode()/Decode() may be called concurrently from any thread, Submit*() runs the job on the internal thread pool.
+class CodecService
+{
+    const std::shared_ptr<const ReedSolomon>    m_Codec;
+    mutable WorkspacePool                       m_WorkspacePool;
+    ThreadPool                                  m_ThreadPool; // Declared last: joined before the workspaces are freed
+    
+public:
+    // Zero threads selects std::thread::hardware_concurrency()
+    explicit CodecService(std::shared_ptr<const ReedSolomon> codec, uint64_t numOfThreads = 0);
+    
+    CodecService(const CodecService&) = delete;
+    CodecService& operator=(const CodecService&) = delete;
+    
+    // Synchronous, thread-safe
+    [[nodiscard]] std::vector<RSWord> Encode(const std::vector<RSWord>& message) const;
+    [[nodiscard]] DecodeResult Decode(const std::vector<RSWord>& data, const std::vector<uint64_t>*erasurePositions = nullptr) const;
+    
+    // Allocation free: codeword holds message.size() + nsym symbols, message holds data.size() - nsym symbols.
+    // Decode() returns the number of errors found.
+    void Encode(std::span<const RSWord> message, std::span<RSWord> codeword) const;
+    uint64_t Decode(std::span<const RSWord> data, std::span<RSWord> message, const std::vector<uint64_t>*erasurePositions = nullptr) const;
+    
+    // Asynchronous, executed on the service's thread pool
+    [[nodiscard]] std::future<std::vector<RSWord>> SubmitEncode(std::vector<RSWord> message);
+    [[nodiscard]] std::future<DecodeResult> SubmitDecode(std::vector<RSWord> data, std::vector<uint64_t> erasurePositions = {});
+    
+    [[nodiscard]] const ReedSolomon& GetCodec() const noexcept { return *m_Codec; }
+    [[nodiscard]] uint64_t GetNumberOfThreads() const noexcept { return m_ThreadPool.GetNumberOfThreads(); }
+};
+}
+
+#endif /* CodecService_hpp */
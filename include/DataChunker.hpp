@@ -50,6 +50,10 @@ public:
     template <typename T>
     static std::vector<std::vector<T>> ChunkData(const std::vector<T>& data, uint64_t chunkSize);
     
+    // Chunks allocated from resource, e.g. one arena per batch that is released at once
+    template <typename T, typename Allocator>
+    static std::pmr::vector<std::pmr::vector<T>> ChunkData(const std::vector<T, Allocator>& data, uint64_t chunkSize, std::pmr::memory_resource*resource);
+    
     // Chunk string
     template <typename T>
     static std::vector<std::vector<T>> ChunkString(const std::string& str, uint64_t chunkSize);
@@ -57,6 +61,9 @@ public:
     // Assemble chunks to continuous data stream
     template <typename T>
     static std::vector<T> AssembleChunks(const std::vector<std::vector<T>>& chunks);
+    
+    template <typename T>
+    static std::pmr::vector<T> AssembleChunks(const std::pmr::vector<std::pmr::vector<T>>& chunks, std::pmr::memory_resource*resource);
 };
 
 template <typename T>
@@ -77,7 +84,7 @@ std::vector<std::vector<T>> DataChunker::ChunkData(const std::vector<T>& data, c
     // Allocate memory
     for(uint64_t i = 0; i < numOfChunks; i++)
     {
-        if(i == numOfChunks - 1)
+        if(i == numOfChunks - 1 && remainderChunkSize > 0)
             allChunks[i].resize(remainderChunkSize); // Last chunk
         else
             allChunks[i].resize(chunkSize);
@@ -103,6 +110,28 @@ std::vector<std::vector<T>> DataChunker::ChunkData(const std::vector<T>& data, c
     return allChunks;
 }
 
+template <typename T, typename Allocator>
+std::pmr::vector<std::pmr::vector<T>> DataChunker::ChunkData(const std::vector<T, Allocator>& data, const uint64_t chunkSize, std::pmr::memory_resource* const resource)
+{
+    if(chunkSize < 1)
+        throw std::invalid_argument("Chunk size cannot be smaller than one byte.");
+    
+    if(data.empty())
+        throw std::runtime_error("Data size is zero.");
+    
+    // The outer vector passes its resource on to the chunks
+    std::pmr::vector<std::pmr::vector<T>> allChunks(resource);
+    allChunks.reserve((data.size() + chunkSize - 1) / chunkSize);
+    
+    for(uint64_t offset = 0; offset < data.size(); offset += chunkSize)
+    {
+        const uint64_t size = std::min<uint64_t>(chunkSize, data.size() - offset);
+        allChunks.emplace_back(data.data() + offset, data.data() + offset + size);
+    }
+    
+    return allChunks;
+}
+
 template <typename T>
 std::vector<std::vector<T>> DataChunker::ChunkString(const std::string& str, const uint64_t chunkSize)
 {
@@ -124,7 +153,7 @@ std::vector<std::vector<T>> DataChunker::ChunkString(const std::string& str, con
     // Allocate memory
     for(uint64_t i = 0; i < numOfChunks; i++)
     {
-        if(i == numOfChunks - 1)
+        if(i == numOfChunks - 1 && remainderChunkSize > 0)
             allChunks[i].resize(remainderChunkSize); // Last chunk
         else
             allChunks[i].resize(chunkSize);
@@ -183,6 +212,23 @@ std::vector<T> DataChunker::AssembleChunks(const std::vector<std::vector<T>>& ch
     
     return assembled;
 }
+
+template <typename T>
+std::pmr::vector<T> DataChunker::AssembleChunks(const std::pmr::vector<std::pmr::vector<T>>& chunks, std::pmr::memory_resource* const resource)
+{
+    uint64_t totalSize = 0;
+    
+    for(const std::pmr::vector<T>& chunk : chunks)
+        totalSize += chunk.size();
+    
+    std::pmr::vector<T> assembled(resource);
+    assembled.reserve(totalSize);
+    
+    for(const std::pmr::vector<T>& chunk : chunks)
+        assembled.insert(assembled.end(), chunk.begin(), chunk.end());
+    
+    return assembled;
+}
 }
 
 #endif /* DataChunker_hpp */
@@ -36,6 +36,12 @@ the following restrictions:
 
 namespace NReedSolomon
 {
+enum class GaloisFieldBackend
+{
+    Table,  // Log/exp table lookups
+    GFNI    // x86 GF2P8AFFINEQB/GF2P8MULB (GF(2^8) only), selected by CPUID
+};
+
 class GaloisField
 {
     const uint64_t          m_PrimitivePolynomial;
@@ -44,13 +50,22 @@ class GaloisField
     const uint64_t          m_Exponent = 0;
     const uint64_t          m_Cardinality = 0;
     
-    std::vector<RSWord>     m_ExponentialTable;
-    std::vector<RSWord>     m_LogarithmicTable;
+    // Tables start on a cache line
+    AlignedVector<RSWord>   m_ExponentialTable;
+    AlignedVector<RSWord>   m_LogarithmicTable;
+    
+    // Hardware acceleration
+    GaloisFieldBackend      m_Backend = GaloisFieldBackend::Table;
+    AlignedVector<uint64_t> m_AffineMatrices;           // Bit matrix of "multiply by c" for every c
+    AlignedVector<RSWord>   m_ToHardwareDomainTable;    // Isomorphism into the field GF2P8MULB works in (x^8 + x^4 + x^3 + x + 1)
+    uint64_t                m_ToHardwareDomainMatrix = 0;
+    uint64_t                m_FromHardwareDomainMatrix = 0;
     
     void PrecomputeTables();
+    void PrecomputeHardwareTables();
     
 public:
-    explicit GaloisField(uint64_t exponent);
+    explicit GaloisField(uint64_t exponent, bool allowHardwareAcceleration = true);
     
     [[nodiscard]] RSWord Add(RSWord x, RSWord y) const noexcept;
     [[nodiscard]] RSWord Subtract(RSWord x, RSWord y) const noexcept;
@@ -59,8 +74,18 @@ public:
     [[nodiscard]] RSWord Pow(RSWord x, RSWord power) const;
     [[nodiscard]] RSWord Inverse(RSWord x) const;
     
-    [[nodiscard]] const std::vector<RSWord>& GetExponentialTable() const noexcept { return m_ExponentialTable; }
-    [[nodiscard]] const std::vector<RSWord>& GetLogarithmicTable() const noexcept { return m_LogarithmicTable; }
+    // Bulk operations: destination = factor * source, destination += factor * source
+    void MultiplyRegion(RSWord*destination, const RSWord*source, RSWord factor, uint64_t length) const;
+    void MultiplyAccumulate(RSWord*destination, const RSWord*source, RSWord factor, uint64_t length) const;
+    
+    [[nodiscard]] GaloisFieldBackend GetBackend() const noexcept { return m_Backend; }
+    [[nodiscard]] uint64_t GetAffineMatrix(RSWord factor) const { return m_AffineMatrices[factor]; }
+    [[nodiscard]] RSWord ToHardwareDomain(RSWord x) const { return m_ToHardwareDomainTable[x]; }
+    [[nodiscard]] uint64_t GetToHardwareDomainMatrix() const noexcept { return m_ToHardwareDomainMatrix; }
+    [[nodiscard]] uint64_t GetFromHardwareDomainMatrix() const noexcept { return m_FromHardwareDomainMatrix; }
+    
+    [[nodiscard]] const AlignedVector<RSWord>& GetExponentialTable() const noexcept { return m_ExponentialTable; }
+    [[nodiscard]] const AlignedVector<RSWord>& GetLogarithmicTable() const noexcept { return m_LogarithmicTable; }
     
     [[nodiscard]] uint64_t    GetCharacteristic() const   { return m_Characteristic; }
     [[nodiscard]] uint64_t    GetExponent() const         { return m_Exponent; }
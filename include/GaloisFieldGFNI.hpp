@@ -0,0 +1,72 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  GaloisFieldGFNI.hpp                                             */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#ifndef GaloisFieldGFNI_hpp
+#define GaloisFieldGFNI_hpp
+
+// Kernels are compiled with function level target attributes and only called after a CPUID check
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+    #define RS_GFNI_KERNELS 1
+#else
+    #define RS_GFNI_KERNELS 0
+#endif
+
+namespace NReedSolomon
+{
+class GaloisField;
+
+// AVX2 + GFNI kernels for GF(2^8).
+// GF2P8AFFINEQB multiplies by a constant through its 8x8 bit matrix and works for any field polynomial.
+// GF2P8MULB is fixed to x^8 + x^4 + x^3 + x + 1, so the syndrome and parity kernels map their input into that
+// (isomorphic) field with one affine transform, multiply there and map the result back.
+namespace GFNI
+{
+    [[nodiscard]] bool IsSupported();
+    
+    // destination = matrix * source (or destination ^= matrix * source)
+    void MultiplyRegion(RSWord*destination, const RSWord*source, uint64_t matrix, uint64_t length, bool accumulate);
+    
+    // Horner's scheme continued from the values in syndromes (zero to start): syndromes[i] = data(alpha^i), i < numOfSyndromes
+    void CalculateSyndromes(const GaloisField& galoisField, const RSWord*data, uint64_t length, uint64_t numOfSyndromes, RSWord*syndromes);
+    
+    // Same for callers keeping the syndromes across calls: roots (alpha^i) and syndromes stay in the hardware domain
+    // and are zero padded to full vectors of 32 symbols, data is in the normal domain
+    void AccumulateSyndromes(const GaloisField& galoisField, const RSWord*roots, const RSWord*data, uint64_t length, uint64_t numOfSyndromes, RSWord*syndromes);
+    
+    // Remainder of message * x^nsym divided by the monic generator (generator[0] is the leading 1),
+    // continued from the remainder in parity (zero to start)
+    void CalculateParity(const GaloisField& galoisField, const RSWord*generator, uint64_t nsym, const RSWord*message, uint64_t length, RSWord*parity);
+}
+}
+
+#endif /* GaloisFieldGFNI_hpp */
@@ -0,0 +1,73 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  IncrementalEncoder.hpp                                          */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#ifndef IncrementalEncoder_hpp
+#define IncrementalEncoder_hpp
+
+namespace NReedSolomon
+{
+// Updates parity and syndromes of an existing codeword after a few symbols changed.
+// The code is linear, so only the contribution of (oldValue ^ newValue) has to be added:
+// O(changed * nsym) instead of re-encoding the full message.
+//
+// Append-only data: encode with a fixed message length (the capacity) and zeros in the unwritten tail.
+// Appending is then just a modification of zero symbols.
+class IncrementalEncoder
+{
+    const ReedSolomon*      m_ReedSolomon = nullptr;
+    const GaloisField*      m_GaloisField = nullptr;
+    
+    uint64_t                m_MaxMessageLength = 0;
+    AlignedVector<RSWord>   m_ParityBasis; // Row r holds x^(nsym + r) mod generator, nsym symbols per row
+    
+    void PrecomputeParityBasis();
+    
+public:
+    explicit IncrementalEncoder(const ReedSolomon& reedSolomon);
+    
+    // Message symbol at position changed, parity belongs to a message of length messageLength
+    void UpdateParity(RSWord*parity, uint64_t messageLength, uint64_t position, RSWord oldValue, RSWord newValue) const;
+    void UpdateParity(RSWord*parity, uint64_t messageLength, uint64_t position, const RSWord*oldData, const RSWord*newData, uint64_t count) const;
+    
+    // Codeword symbol at position changed (message or parity), syndromes[i] = codeword(alpha^i)
+    void UpdateSyndromes(RSWord*syndromes, uint64_t codewordLength, uint64_t position, RSWord oldValue, RSWord newValue) const;
+    void UpdateSyndromes(RSWord*syndromes, uint64_t codewordLength, uint64_t position, const RSWord*oldData, const RSWord*newData, uint64_t count) const;
+    
+    // Overwrite message symbols of an encoded codeword starting at position and patch its parity in place
+    void ModifyCodeword(std::vector<RSWord>& codeword, uint64_t position, const std::vector<RSWord>& newData) const;
+    
+    [[nodiscard]] uint64_t GetMaxMessageLength() const noexcept { return m_MaxMessageLength; }
+};
+}
+
+#endif /* IncrementalEncoder_hpp */
@@ -0,0 +1,88 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  InlinePolynomial.hpp                                            */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#ifndef InlinePolynomial_hpp
+#define InlinePolynomial_hpp
+
+namespace NReedSolomon
+{
+// Polynomial with fixed capacity storage inside the object (no heap).
+// A codeword has at most 2^bits - 1 symbols, so every syndrome, locator and evaluator polynomial fits.
+class InlinePolynomial
+{
+public:
+    static constexpr uint64_t Capacity = uint64_t(1) << (8 * sizeof(RSWord));
+    
+private:
+    const GaloisField*                  m_GaloisField = nullptr;
+    
+    uint64_t                            m_NumOfCoefficients = 0;
+    std::array<RSWord, Capacity>        m_Coefficients;
+    
+    void CheckCapacity(uint64_t numOfCoefficients) const;
+    
+public:
+    explicit InlinePolynomial(const GaloisField*galoisField);
+    InlinePolynomial(std::initializer_list<RSWord> coefficients, const GaloisField*galoisField);
+    InlinePolynomial(const RSWord*coefficients, uint64_t numOfCoefficients, const GaloisField*galoisField);
+    
+    // Operations changing object state
+    void Add(const InlinePolynomial& polynomial);
+    void Scale(RSWord scalar);
+    void Multiply(const InlinePolynomial& polynomial);
+    
+    // Keeps only the numOfCoefficients lowest degree coefficients of the product (the product modulo x^n),
+    // the full product does not need to fit into the inline storage
+    void MultiplyTruncated(const InlinePolynomial& polynomial, uint64_t numOfCoefficients);
+    void Reverse();
+    
+    // Operations not changing object state
+    InlinePolynomial operator* (RSWord scalar) const;
+    [[nodiscard]] RSWord Evaluate(RSWord x) const;
+    [[nodiscard]] std::pmr::vector<uint64_t> ChienSearch(uint64_t max, std::pmr::memory_resource*resource = std::pmr::get_default_resource()) const;
+    
+    // Change size
+    void Enlarge(uint64_t numElementsToAdd, RSWord value = 0);
+    void TrimEnd(uint64_t numElementsToTrim);
+    void TrimBeginning(uint64_t numElementsToTrim);
+    
+    // Getter
+    [[nodiscard]] uint64_t GetNumberOfCoefficients() const noexcept { return m_NumOfCoefficients; }
+    [[nodiscard]] const RSWord* GetCoefficients() const noexcept { return m_Coefficients.data(); }
+    
+    RSWord operator[] (const uint64_t index) const { return m_Coefficients[index]; }
+    RSWord& operator[] (const uint64_t index) { return m_Coefficients[index]; }
+};
+}
+
+#endif /* InlinePolynomial_hpp */
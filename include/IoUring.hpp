@@ -0,0 +1,101 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  IoUring.hpp                                                     */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#ifndef IoUring_hpp
+#define IoUring_hpp
+
+#if defined(__linux__)
+    #define RS_IO_URING 1
+#else
+    #define RS_IO_URING 0
+#endif
+
+namespace NReedSolomon
+{
+// Minimal io_uring submission/completion queue pair on the raw system calls, no liburing needed.
+// Not thread-safe: one thread prepares, submits and reaps. Requires Linux 5.6 (IORING_OP_READ/WRITE).
+class IoUring
+{
+    int         m_RingFd = -1;
+    uint32_t    m_NumOfEntries = 0;
+    uint32_t    m_NumOfPrepared = 0; // Prepared but not yet submitted
+    
+    void*       m_SubmissionRing = nullptr;
+    void*       m_CompletionRing = nullptr;
+    void*       m_SubmissionEntries = nullptr;
+    uint64_t    m_SubmissionRingSize = 0;
+    uint64_t    m_CompletionRingSize = 0;
+    uint64_t    m_SubmissionEntriesSize = 0;
+    
+    uint32_t*   m_SubmissionHead = nullptr;
+    uint32_t*   m_SubmissionTail = nullptr;
+    uint32_t*   m_SubmissionMask = nullptr;
+    uint32_t*   m_SubmissionArray = nullptr;
+    uint32_t*   m_CompletionHead = nullptr;
+    uint32_t*   m_CompletionTail = nullptr;
+    uint32_t*   m_CompletionMask = nullptr;
+    void*       m_CompletionEntries = nullptr;
+    
+    void Release() noexcept;
+    void Prepare(uint8_t opcode, int fd, const void*buffer, uint32_t length, uint64_t offset, uint64_t userData);
+    void Enter(uint32_t numToSubmit, uint32_t minComplete);
+    
+public:
+    struct Completion
+    {
+        uint64_t    userData = 0;
+        int32_t     result = 0; // Bytes transferred or -errno
+    };
+    
+    // Probes the kernel once
+    [[nodiscard]] static bool IsSupported();
+    
+    explicit IoUring(uint32_t numOfEntries);
+    ~IoUring();
+    
+    IoUring(const IoUring&) = delete;
+    IoUring& operator=(const IoUring&) = delete;
+    
+    // At most GetNumberOfEntries() requests may be in flight
+    void PrepareRead(int fd, void*buffer, uint32_t length, uint64_t offset, uint64_t userData);
+    void PrepareWrite(int fd, const void*buffer, uint32_t length, uint64_t offset, uint64_t userData);
+    void Submit();
+    
+    // Submits prepared requests and blocks until a completion is available
+    [[nodiscard]] Completion WaitForCompletion();
+    
+    [[nodiscard]] uint32_t GetNumberOfEntries() const noexcept { return m_NumOfEntries; }
+};
+}
+
+#endif /* IoUring_hpp */
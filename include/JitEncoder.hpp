@@ -0,0 +1,94 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  JitEncoder.hpp                                                  */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#ifndef JitEncoder_hpp
+#define JitEncoder_hpp
+
+// Machine code is only emitted for the System V x86-64 ABI, everything else uses the portable encoder
+#if defined(__x86_64__) && defined(__linux__)
+    #define RS_JIT_KERNELS 1
+#else
+    #define RS_JIT_KERNELS 0
+#endif
+
+namespace NReedSolomon
+{
+// Encoder with a kernel generated at construction time for the generator polynomial of one codec.
+// The parity LFSR lives in SSE registers for the whole message: per message symbol the feedback selects a
+// row of the precomputed products generator * feedback, the registers are shifted by one symbol and the
+// row is XORed in, all fully unrolled over the nsym / 16 registers.
+//
+// Falls back to ReedSolomon::AccumulateParity() if the platform is not supported, the CPU lacks SSSE3,
+// the code cannot be mapped executable or nsym exceeds MaxNumOfErrorCorrectingSymbols.
+class JitEncoder
+{
+    struct alignas(16) Vector
+    {
+        RSWord bytes[16] = {};
+    };
+    
+    // state holds the remainder, zero padded to a multiple of 16 symbols
+    using Kernel = void (*)(const RSWord*message, uint64_t length, RSWord*state);
+    
+    const ReedSolomon*      m_ReedSolomon = nullptr;
+    const uint64_t          m_NumOfErrorCorrectingSymbols = 0;
+    
+    AlignedVector<Vector>   m_Products;         // Row f holds generator[1..nsym] * f
+    uint64_t                m_RowStride = 0;    // Vectors per row, a power of two
+    
+    void*                   m_Code = nullptr;
+    uint64_t                m_CodeSize = 0;
+    Kernel                  m_Kernel = nullptr;
+    
+    void CreateProductTable();
+    void Compile();
+    
+public:
+    static constexpr uint64_t MaxNumOfErrorCorrectingSymbols = 14 * 16;
+    
+    explicit JitEncoder(const ReedSolomon& reedSolomon, bool allowJit = true);
+    JitEncoder(const JitEncoder&) = delete;
+    JitEncoder& operator=(const JitEncoder&) = delete;
+    ~JitEncoder();
+    
+    // Same results as the corresponding ReedSolomon methods
+    [[nodiscard]] std::vector<RSWord> Encode(const std::vector<RSWord>& message) const;
+    void CalculateParity(const RSWord*message, uint64_t length, RSWord*parity) const;
+    void AccumulateParity(const RSWord*message, uint64_t length, RSWord*parity) const;
+    
+    [[nodiscard]] bool IsCompiled() const noexcept { return m_Kernel != nullptr; }
+    [[nodiscard]] uint64_t GetCodeSize() const noexcept { return m_CodeSize; }
+};
+}
+
+#endif /* JitEncoder_hpp */
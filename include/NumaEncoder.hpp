@@ -0,0 +1,152 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  NumaEncoder.hpp                                                 */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#ifndef NumaEncoder_hpp
+#define NumaEncoder_hpp
+
+#if defined(__linux__)
+    #define RS_NUMA 1
+#else
+    #define RS_NUMA 0
+#endif
+
+namespace NReedSolomon
+{
+struct NumaNode
+{
+    uint64_t                id = 0;
+    std::vector<uint64_t>   cpus;
+};
+
+// Memory nodes and their CPUs, read from /sys/devices/system/node (no libnuma needed).
+// Without NUMA information a single node holding all CPUs is reported.
+class NumaTopology
+{
+    std::vector<NumaNode>   m_Nodes;
+    
+public:
+    explicit NumaTopology(std::vector<NumaNode> nodes);
+    
+    [[nodiscard]] static NumaTopology Detect();
+    
+    [[nodiscard]] const std::vector<NumaNode>& GetNodes() const noexcept { return m_Nodes; }
+    [[nodiscard]] uint64_t GetNumberOfNodes() const noexcept { return m_Nodes.size(); }
+};
+
+// Codewords of a large buffer, split into one contiguous partition per node. Every partition is a separate
+// mapping that is first written by the workers of its node, so its pages are allocated there.
+class NumaCodewordBuffer
+{
+    friend class NumaEncoder;
+    
+    struct Partition
+    {
+        uint64_t                    node = 0;   // Index into the encoder's nodes
+        uint64_t                    firstCodeword = 0;
+        uint64_t                    numOfCodewords = 0;
+        std::unique_ptr<BufferPool> memory;
+    };
+    
+    uint64_t                m_MessageLength = 0;
+    uint64_t                m_CodewordLength = 0;
+    uint64_t                m_LastMessageLength = 0; // The last message may be shorter
+    uint64_t                m_NumOfCodewords = 0;
+    std::vector<Partition>  m_Partitions;
+    
+    [[nodiscard]] const Partition& FindPartition(uint64_t index) const;
+    
+public:
+    [[nodiscard]] std::span<RSWord> GetCodeword(uint64_t index);
+    [[nodiscard]] std::span<const RSWord> GetCodeword(uint64_t index) const;
+    
+    // Home node (index into NumaTopology::GetNodes()) of a codeword
+    [[nodiscard]] uint64_t GetNode(uint64_t index) const { return FindPartition(index).node; }
+    
+    [[nodiscard]] uint64_t GetNumberOfCodewords() const noexcept { return m_NumOfCodewords; }
+    [[nodiscard]] uint64_t GetMessageLength() const noexcept { return m_MessageLength; }
+    [[nodiscard]] uint64_t GetCodewordLength() const noexcept { return m_CodewordLength; }
+};
+
+struct NumaEncoderSettings
+{
+    uint64_t    threadsPerNode = 0;     // Zero uses one worker per CPU of the node
+    uint64_t    batchSize = 64;         // Codewords a worker claims at a time
+    PageMode    pageMode = PageMode::Default;
+};
+
+struct NumaDecodeReport
+{
+    uint64_t    numOfErrorsCorrected = 0;
+    uint64_t    numOfFailedCodewords = 0;
+};
+
+// Parallel encoder for multi-socket machines. Every node has its own workers, pinned to the node's CPUs, and
+// its own codec replica: the field tables and the generator polynomial are allocated and filled by one of
+// the node's workers, so first-touch places them in node-local memory and no worker reads tables across the
+// interconnect. Work on a NumaCodewordBuffer only runs on the home node of each partition.
+class NumaEncoder
+{
+    struct Node
+    {
+        NumaNode                        node;
+        std::unique_ptr<ReedSolomon>    codec;
+        std::unique_ptr<ThreadPool>     threadPool; // Destroyed first, its tasks use the codec
+    };
+    
+    const uint64_t          m_BitsPerWord = 0;
+    const uint64_t          m_NumOfErrorCorrectingSymbols = 0;
+    const NumaEncoderSettings m_Settings;
+    std::vector<Node>       m_Nodes;
+    
+    // Calls function(codec, codeword index) for all codewords of the buffer, each on its home node
+    void ForEachCodeword(const NumaCodewordBuffer& buffer, const std::function<void(const ReedSolomon&, uint64_t)>& function) const;
+    
+public:
+    NumaEncoder(uint64_t bitsPerWord, uint64_t numOfErrorCorrectingSymbols, const NumaTopology& topology = NumaTopology::Detect(), const NumaEncoderSettings& settings = {});
+    
+    NumaEncoder(const NumaEncoder&) = delete;
+    NumaEncoder& operator=(const NumaEncoder&) = delete;
+    
+    // Splits data into messages of messageLength (the last one may be shorter) and encodes them
+    [[nodiscard]] NumaCodewordBuffer Encode(std::span<const RSWord> data, uint64_t messageLength) const;
+    
+    // Corrects all codewords in place
+    NumaDecodeReport Decode(NumaCodewordBuffer& buffer) const;
+    
+    [[nodiscard]] uint64_t GetNumberOfNodes() const noexcept { return m_Nodes.size(); }
+    [[nodiscard]] uint64_t GetNumberOfThreads() const;
+    [[nodiscard]] const ReedSolomon& GetCodec(uint64_t node) const { return *m_Nodes.at(node).codec; }
+};
+}
+
+#endif /* NumaEncoder_hpp */
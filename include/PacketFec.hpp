@@ -0,0 +1,140 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  PacketFec.hpp                                                   */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#ifndef PacketFec_hpp
+#define PacketFec_hpp
+
+namespace NReedSolomon
+{
+// Packet level FEC: byte c of every source packet in a window is one message symbol of column codeword c,
+// the M repair packets hold the parity of all columns. Any M lost packets of a window (source or repair)
+// are recovered through the erasure decoder. Source packets are coded with a 2 byte length prefix and zero
+// padded to the longest packet of the window, so packets of any length up to MaxPayloadSize can be mixed.
+//
+//   Block mode    (repairInterval = 0): the stream is cut into windows of K source packets, M repair packets follow each.
+//   Sliding mode  (repairInterval = S): M repair packets over the last K source packets follow every S source packets,
+//                 a lost packet can be recovered as soon as the next repairs covering it arrive (S packets later).
+struct PacketFecSettings
+{
+    uint64_t    numOfSourcePackets = 16;    // K, source packets per window
+    uint64_t    numOfRepairPackets = 4;     // M, repair packets per window, K + M <= 255
+    uint64_t    repairInterval = 0;         // Source packets between repairs in sliding mode, 0 for block mode
+};
+
+struct FecPacket
+{
+    static constexpr uint64_t HeaderSize = 12;
+    
+    bool                isRepair = false;
+    uint64_t            sequence = 0;           // Source: sequence number, repair: first source packet of the window
+    uint64_t            windowLength = 0;       // Repair only: source packets covered
+    uint64_t            repairIndex = 0;        // Repair only
+    uint64_t            numOfRepairPackets = 0; // Repair only
+    std::vector<RSWord> payload;
+    
+    // Wire format (little endian): type u8, repairIndex u8, windowLength u8, numOfRepairPackets u8, sequence u64, payload
+    [[nodiscard]] std::vector<RSWord> Serialize() const;
+    [[nodiscard]] static FecPacket Parse(std::span<const RSWord> data);
+};
+
+class PacketFecEncoder
+{
+    const PacketFecSettings             m_Settings;
+    const ReedSolomon                   m_ReedSolomon;
+    std::vector<RSWord>                 m_Coefficients; // Row r: parity of the symbol r positions before the end of the window
+    
+    std::deque<std::vector<RSWord>>     m_Window;       // Coded source packets, most recent last
+    uint64_t                            m_NextSequence = 0;
+    uint64_t                            m_SinceRepair = 0;
+    
+    void AppendRepairPackets(uint64_t windowLength, std::vector<FecPacket>& packets) const;
+    
+public:
+    static constexpr uint64_t MaxPayloadSize = 65535;
+    
+    explicit PacketFecEncoder(const PacketFecSettings& settings);
+    
+    // Returns the source packet for payload followed by the repair packets that became due
+    [[nodiscard]] std::vector<FecPacket> Push(std::span<const RSWord> payload);
+    
+    // Repair packets for the source packets not yet covered, e.g. at the end of a stream in block mode
+    [[nodiscard]] std::vector<FecPacket> Flush();
+};
+
+struct FecDeliveredPacket
+{
+    uint64_t            sequence = 0;
+    std::vector<RSWord> payload;
+    bool                recovered = false;
+};
+
+struct PacketFecStatistics
+{
+    uint64_t    sourcePacketsReceived = 0;
+    uint64_t    repairPacketsReceived = 0;
+    uint64_t    packetsRecovered = 0;
+    uint64_t    windowsFailed = 0;      // Could not be decoded although enough packets arrived
+};
+
+// Delivers every source packet as soon as it arrives or can be recovered, not necessarily in order.
+// Packets older than the history (two windows plus the repair interval behind the newest) are forgotten.
+class PacketFecDecoder
+{
+    struct Window
+    {
+        std::map<uint64_t, std::vector<RSWord>> repairs; // By repair index
+    };
+    
+    const PacketFecSettings                     m_Settings;
+    const ReedSolomon                           m_ReedSolomon;
+    const uint64_t                              m_HistoryLength = 0;
+    
+    std::map<uint64_t, std::vector<RSWord>>     m_SourcePackets;    // Coded, received or recovered
+    std::map<std::pair<uint64_t, uint64_t>, Window> m_Windows;      // By first sequence and length, not yet complete
+    uint64_t                                    m_NewestSequence = 0;
+    PacketFecStatistics                         m_Statistics;
+    
+    [[nodiscard]] bool Recover(uint64_t first, uint64_t length, const Window& window, std::vector<FecDeliveredPacket>& delivered);
+    void Prune();
+    
+public:
+    explicit PacketFecDecoder(const PacketFecSettings& settings);
+    
+    // Returns the source packets that became available through this packet
+    [[nodiscard]] std::vector<FecDeliveredPacket> Receive(const FecPacket& packet);
+    
+    [[nodiscard]] const PacketFecStatistics& GetStatistics() const noexcept { return m_Statistics; }
+};
+}
+
+#endif /* PacketFec_hpp */
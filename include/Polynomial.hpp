@@ -37,17 +37,19 @@ the following restrictions:
 namespace NReedSolomon
 {
     using coef_diff_type = std::vector<RSWord>::difference_type;
+// Coefficients and all temporaries of the operations are allocated from the memory resource passed on construction.
+// Like std::pmr containers, copies use the default resource.
 class Polynomial
 {
-    const GaloisField*  m_GaloisField = nullptr;
+    const GaloisField*          m_GaloisField = nullptr;
     
-    uint64_t            m_NumOfCoefficients = 0;
-    std::vector<RSWord> m_Coefficients;
+    uint64_t                    m_NumOfCoefficients = 0;
+    std::pmr::vector<RSWord>    m_Coefficients;
     
 public:
-    explicit Polynomial(const GaloisField*galoisField);
-    Polynomial(const std::vector<RSWord>& coefficients, const GaloisField*galoisField);
-    Polynomial(const RSWord*coefficients, uint64_t numOfCoefficients, const GaloisField*galoisField);
+    explicit Polynomial(const GaloisField*galoisField, std::pmr::memory_resource*resource = std::pmr::get_default_resource());
+    Polynomial(const std::vector<RSWord>& coefficients, const GaloisField*galoisField, std::pmr::memory_resource*resource = std::pmr::get_default_resource());
+    Polynomial(const RSWord*coefficients, uint64_t numOfCoefficients, const GaloisField*galoisField, std::pmr::memory_resource*resource = std::pmr::get_default_resource());
     
     void SetNew(const std::vector<RSWord>& coefficients, const GaloisField*galoisField = nullptr);
     void SetNew(const RSWord*coefficients, uint64_t numOfCoefficients, const GaloisField*galoisField = nullptr);
@@ -66,7 +68,7 @@ public:
     // Operations not changing object state
     Polynomial operator* (RSWord scalar) const;
     [[nodiscard]] RSWord Evaluate(RSWord x) const;
-    [[nodiscard]] std::vector<uint64_t> ChienSearch(uint64_t max) const;
+    [[nodiscard]] std::pmr::vector<uint64_t> ChienSearch(uint64_t max) const;
     
     // Change size
     void Enlarge(uint64_t numElementsToAdd, RSWord value = 0);
@@ -75,7 +77,8 @@ public:
     
     // Getter
     [[nodiscard]] uint64_t GetNumberOfCoefficients() const { return m_NumOfCoefficients; }
-    [[nodiscard]] const std::vector<RSWord>* GetCoefficients() const noexcept { return &m_Coefficients; }
+    [[nodiscard]] const std::pmr::vector<RSWord>* GetCoefficients() const noexcept { return &m_Coefficients; }
+    [[nodiscard]] std::pmr::memory_resource* GetMemoryResource() const noexcept { return m_Coefficients.get_allocator().resource(); }
     
     RSWord operator[] (const uint64_t index) const { return m_Coefficients[index]; }
     RSWord& operator[] (const uint64_t index) { return m_Coefficients[index]; }
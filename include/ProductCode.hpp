@@ -0,0 +1,92 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  ProductCode.hpp                                                 */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#ifndef ProductCode_hpp
+#define ProductCode_hpp
+
+namespace NReedSolomon
+{
+struct ProductCodeReport
+{
+    bool        success = false;
+    uint64_t    numOfIterations = 0;
+    uint64_t    symbolsCorrected = 0;
+    uint64_t    numOfFailedRows = 0;        // After the last iteration
+    uint64_t    numOfFailedColumns = 0;
+};
+
+// Two-dimensional product code: numOfDataRows x numOfDataColumns data symbols, every row is encoded with the row codec,
+// then every column (including the row parity columns) with the column codec. The block is stored row major:
+//
+//   [ data         | row parity       ]   numOfDataRows
+//   [ column parity| parity of parity ]   numOfColumnParitySymbols
+//
+// Decoding alternates row and column passes, each parallel across the thread pool. Rows that fail are passed to
+// the column pass as erasures and failing columns back to the next row pass, so a burst that wipes out whole rows
+// is repaired by the columns and scattered errors by the rows. Iteration stops when no pass changes anything.
+class ProductCode
+{
+    const ReedSolomon   m_RowCodec;
+    const ReedSolomon   m_ColumnCodec;
+    const uint64_t      m_NumOfDataRows = 0;
+    const uint64_t      m_NumOfDataColumns = 0;
+    mutable ThreadPool  m_ThreadPool; // Declared last: joined before the codecs are destroyed
+    
+    // Returns true if all rows are valid codewords, failedColumns are used as erasures and failedRows updated
+    bool DecodeRows(std::span<RSWord> block, const std::vector<uint8_t>& failedColumns, std::vector<uint8_t>& failedRows, uint64_t& numOfCorrections) const;
+    bool DecodeColumns(std::span<RSWord> block, const std::vector<uint8_t>& failedRows, std::vector<uint8_t>& failedColumns, uint64_t& numOfCorrections) const;
+    
+public:
+    static constexpr uint64_t DefaultMaxIterations = 8;
+    
+    // Zero threads selects std::thread::hardware_concurrency()
+    ProductCode(uint64_t numOfDataRows, uint64_t numOfDataColumns, uint64_t numOfRowParitySymbols, uint64_t numOfColumnParitySymbols, uint64_t numOfThreads = 0);
+    
+    ProductCode(const ProductCode&) = delete;
+    ProductCode& operator=(const ProductCode&) = delete;
+    
+    // data holds numOfDataRows * numOfDataColumns symbols row major
+    [[nodiscard]] std::vector<RSWord> Encode(std::span<const RSWord> data) const;
+    
+    // Corrects the block in place
+    ProductCodeReport Decode(std::span<RSWord> block, uint64_t maxIterations = DefaultMaxIterations) const;
+    
+    [[nodiscard]] std::vector<RSWord> ExtractData(std::span<const RSWord> block) const;
+    
+    [[nodiscard]] uint64_t GetNumberOfRows() const noexcept { return m_NumOfDataRows + m_ColumnCodec.m_NumOfErrorCorrectingSymbols; }
+    [[nodiscard]] uint64_t GetNumberOfColumns() const noexcept { return m_NumOfDataColumns + m_RowCodec.m_NumOfErrorCorrectingSymbols; }
+    [[nodiscard]] uint64_t GetBlockSize() const noexcept { return GetNumberOfRows() * GetNumberOfColumns(); }
+};
+}
+
+#endif /* ProductCode_hpp */
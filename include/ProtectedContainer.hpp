@@ -0,0 +1,260 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  ProtectedContainer.hpp                                          */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#ifndef ProtectedContainer_hpp
+#define ProtectedContainer_hpp
+
+namespace NReedSolomon
+{
+// Container file format (all integers little endian):
+//
+//   Header           96 bytes, see ContainerHeader
+//   Chunks           numOfChunks chunks, each chunk holds up to chunkSize data bytes split into codewords
+//                    of messageLength data bytes + nsym parity bytes. All chunks but the last one are full,
+//                    so their offsets and sizes follow from the header and are not stored.
+//   Chunk table      With chunk checksums only: numOfChunks entries of ContainerChunkEntry
+//
+// The metadata is protected independently of the data codec: the header is one codeword with 32 parity
+// bytes and every chunk table entry is one codeword with 4 parity bytes, so it can be rewritten on its own.
+//
+// With chunk checksums every table entry holds the CRC-32C of the stored chunk (data and parity).
+// Readers and scrubs only compute syndromes for chunks whose checksum does not match.
+//
+// Interleaved: every codeword is stored as data followed by its parity.
+// Sidecar:     all data of a chunk is stored first, followed by the parity of all its codewords,
+//              so a chunk's data is contiguous and readable without the codec.
+enum class ContainerLayout : uint8_t
+{
+    Interleaved = 0,
+    Sidecar = 1
+};
+
+struct ContainerHeader
+{
+    static constexpr uint32_t   Magic = 0x46435352; // "RSCF"
+    static constexpr uint16_t   FormatVersion = 2;
+    static constexpr uint64_t   FieldsSize = 64;
+    static constexpr uint64_t   ParitySize = 32;
+    static constexpr uint64_t   Size = FieldsSize + ParitySize;
+    
+    ContainerLayout layout = ContainerLayout::Interleaved;
+    uint64_t        bitsPerWord = 0;
+    uint64_t        numOfErrorCorrectingSymbols = 0;
+    uint64_t        messageLength = 0;  // Data bytes per codeword
+    uint64_t        chunkSize = 0;      // Data bytes per chunk, the last chunk may be shorter
+    uint64_t        dataSize = 0;
+    uint64_t        numOfChunks = 0;
+    bool            chunkChecksums = false;
+    
+    // Stored bytes of a chunk holding dataSize bytes of data
+    [[nodiscard]] uint64_t GetStoredChunkSize(uint64_t chunkDataSize) const;
+    
+    // Layout derived from the header, index < numOfChunks
+    [[nodiscard]] uint64_t GetChunkOffset(uint64_t index) const;
+    [[nodiscard]] uint64_t GetChunkDataSize(uint64_t index) const;
+    [[nodiscard]] uint64_t GetTableOffset() const;
+    [[nodiscard]] uint64_t GetTableSize() const;
+    [[nodiscard]] uint64_t GetChunkEntryOffset(uint64_t index) const;
+};
+
+struct ContainerChunkEntry
+{
+    static constexpr uint64_t   ChecksumSize = sizeof(uint32_t);
+    static constexpr uint64_t   ParitySize = 4;
+    static constexpr uint64_t   Size = ChecksumSize + ParitySize;   // Stored bytes, only the checksum is stored
+    
+    uint64_t    offset = 0;             // File offset of the chunk
+    uint64_t    dataSize = 0;           // Data bytes in the chunk
+    uint32_t    checksum = 0;           // CRC-32C of the stored chunk
+    bool        hasChecksum = false;    // False without chunk checksums or if the entry was damaged beyond repair
+};
+
+enum class ContainerChunkState
+{
+    Clean,
+    Corrupted,      // Correctable
+    Uncorrectable
+};
+
+// Chunk encoding and (de)serialization shared by the stream and the asynchronous file paths
+namespace ContainerCodec
+{
+    // Header without data, messageLength = 0 uses the maximum codeword length of the codec
+    [[nodiscard]] ContainerHeader CreateHeader(const ReedSolomon& reedSolomon, uint64_t chunkSize, ContainerLayout layout, uint64_t messageLength, bool chunkChecksums);
+    
+    // Chunk table with derived offsets and sizes, checksums are filled in while encoding
+    [[nodiscard]] std::vector<ContainerChunkEntry> CreateChunkTable(const ContainerHeader& header);
+    
+    // Serialized metadata includes its parity
+    [[nodiscard]] std::array<uint8_t, ContainerHeader::Size> SerializeHeader(const ContainerHeader& header);
+    [[nodiscard]] std::array<uint8_t, ContainerChunkEntry::Size> SerializeChunkEntry(const ContainerChunkEntry& entry);
+    [[nodiscard]] std::vector<uint8_t> SerializeChunkTable(const ContainerHeader& header, const std::vector<ContainerChunkEntry>& chunkTable);
+    
+    // Corrects serialized metadata in place. Returns the number of corrected bytes, throws std::runtime_error
+    // if the damage exceeds the parity.
+    uint64_t CorrectHeader(std::span<uint8_t, ContainerHeader::Size> serializedHeader);
+    uint64_t CorrectChunkEntry(std::span<uint8_t, ContainerChunkEntry::Size> serializedEntry);
+    
+    // Writes header.GetStoredChunkSize(dataSize) bytes to storedChunk
+    void EncodeChunk(const ContainerHeader& header, const ReedSolomon& reedSolomon, const RSWord*data, uint64_t dataSize, RSWord*storedChunk);
+    
+    // Corrects every codeword of a stored chunk in place. Uncorrectable chunks may be partially modified.
+    [[nodiscard]] ContainerChunkState RepairChunk(const ContainerHeader& header, const ReedSolomon& reedSolomon, RSWord*storedChunk, uint64_t dataSize, uint64_t*numOfCorrections = nullptr);
+}
+
+// Streams data into a container file. Chunks are encoded and written as soon as they are full,
+// the chunk table and the final header are written by Finish().
+class ContainerWriter
+{
+    const ReedSolomon*                  m_ReedSolomon = nullptr;
+    ContainerHeader                     m_Header;
+    std::ofstream                       m_File;
+    
+    std::vector<RSWord>                 m_ChunkBuffer;
+    std::vector<RSWord>                 m_StoredChunk;
+    std::vector<ContainerChunkEntry>    m_ChunkTable;
+    uint64_t                            m_FileOffset = 0;
+    bool                                m_Finished = false;
+    
+    void WriteChunk();
+    
+public:
+    static constexpr uint64_t DefaultChunkSize = 64 * 1024;
+    
+    // messageLength = 0 uses the maximum codeword length of the codec
+    ContainerWriter(const std::filesystem::path& path, const ReedSolomon& reedSolomon, uint64_t chunkSize = DefaultChunkSize, ContainerLayout layout = ContainerLayout::Interleaved, uint64_t messageLength = 0, bool chunkChecksums = false);
+    ContainerWriter(const ContainerWriter&) = delete;
+    ContainerWriter& operator=(const ContainerWriter&) = delete;
+    ~ContainerWriter();
+    
+    void Write(std::span<const RSWord> data);
+    void Finish();
+    
+    [[nodiscard]] const ContainerHeader& GetHeader() const noexcept { return m_Header; }
+};
+
+struct ContainerReadStatistics
+{
+    uint64_t    chunksDecoded = 0;
+    uint64_t    chunksVerifiedByChecksum = 0;   // Clean chunks that skipped the syndrome computation
+    uint64_t    cacheHits = 0;
+    uint64_t    symbolsCorrected = 0;
+};
+
+struct ContainerScrubReport
+{
+    uint64_t                chunksVerified = 0;
+    uint64_t                bytesVerified = 0;      // Stored bytes, data and parity
+    std::vector<uint64_t>   corruptedChunks;        // Repaired if the scrub was allowed to repair
+    std::vector<uint64_t>   uncorrectableChunks;
+    bool                    metadataCorrupted = false; // Header or chunk table needed correction, rewritten if repairing
+};
+
+enum class ContainerAccess
+{
+    ReadOnly,
+    ReadWrite   // Allows repairing chunks in place
+};
+
+// Random access to the data of a container. Only the chunks covering a requested byte range are read
+// and decoded, recently decoded chunks are kept in an LRU cache. Not thread-safe, use one reader per thread.
+class ContainerReader
+{
+    struct CacheEntry
+    {
+        std::vector<RSWord>             data;
+        std::list<uint64_t>::iterator   position;
+    };
+    
+    std::fstream                        m_File;
+    const ContainerAccess               m_Access = ContainerAccess::ReadOnly;
+    ContainerHeader                     m_Header;
+    std::vector<ContainerChunkEntry>    m_ChunkTable;
+    std::unique_ptr<ReedSolomon>        m_ReedSolomon;
+    
+    const uint64_t                      m_CacheCapacity = 0;
+    std::list<uint64_t>                 m_RecentlyUsed; // Most recently used chunk first
+    std::unordered_map<uint64_t, CacheEntry> m_Cache;
+    
+    std::vector<RSWord>                 m_StoredChunk;
+    std::vector<RSWord>                 m_Codeword;
+    std::vector<Correction>             m_Corrections;
+    ContainerReadStatistics             m_Statistics;
+    
+    bool                                m_IsHeaderCorrupted = false;
+    std::vector<bool>                   m_IsChunkEntryCorrupted;
+    
+    void ReadHeader();
+    void ReadChunkTable();
+    void WriteChunkEntry(uint64_t index);
+    void ReadFromFile(uint64_t offset, RSWord*destination, uint64_t length);
+    void WriteToFile(uint64_t offset, const RSWord*source, uint64_t length);
+    
+    // Reads the stored chunk into m_StoredChunk, returns true if its checksum proves it clean
+    bool ReadStoredChunk(uint64_t index);
+    
+    // Copies codeword codewordIndex of m_StoredChunk into m_Codeword
+    void LoadCodeword(uint64_t chunkDataSize, uint64_t codewordIndex);
+    
+    const std::vector<RSWord>& GetChunk(uint64_t index);
+    [[nodiscard]] std::vector<RSWord> DecodeChunk(uint64_t index);
+    
+public:
+    static constexpr uint64_t DefaultCacheCapacity = 16;
+    
+    explicit ContainerReader(const std::filesystem::path& path, uint64_t cacheCapacity = DefaultCacheCapacity, ContainerAccess access = ContainerAccess::ReadOnly);
+    
+    // Copies destination.size() bytes starting at offset into destination
+    void Read(uint64_t offset, std::span<RSWord> destination);
+    [[nodiscard]] std::vector<RSWord> Read(uint64_t offset, uint64_t length);
+    
+    // Without repair neither the file nor the cache are changed. With repair, corrupted chunks and
+    // damaged checksums are rewritten in place (requires ContainerAccess::ReadWrite).
+    ContainerChunkState VerifyChunk(uint64_t index, bool repair = false);
+    ContainerScrubReport Scrub(bool repair = false);
+    
+    // Metadata damage is corrected while opening. Chunk entries are rewritten by VerifyChunk(), the header by
+    // RepairHeader() (called by Scrub()).
+    [[nodiscard]] bool IsHeaderCorrupted() const noexcept { return m_IsHeaderCorrupted; }
+    [[nodiscard]] bool IsChunkEntryCorrupted(uint64_t index) const { return m_IsChunkEntryCorrupted.at(index); }
+    void RepairHeader();
+    
+    [[nodiscard]] const ContainerHeader& GetHeader() const noexcept { return m_Header; }
+    [[nodiscard]] uint64_t GetSize() const noexcept { return m_Header.dataSize; }
+    [[nodiscard]] uint64_t GetNumberOfChunks() const noexcept { return m_Header.numOfChunks; }
+    [[nodiscard]] const ContainerChunkEntry& GetChunkEntry(uint64_t index) const { return m_ChunkTable.at(index); }
+    [[nodiscard]] const ContainerReadStatistics& GetStatistics() const noexcept { return m_Statistics; }
+};
+}
+
+#endif /* ProtectedContainer_hpp */
@@ -0,0 +1,75 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  RateCompatibleCodec.hpp                                         */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#ifndef RateCompatibleCodec_hpp
+#define RateCompatibleCodec_hpp
+
+namespace NReedSolomon
+{
+// Serves every parity length from 1 to maxNumOfErrorCorrectingSymbols from one object, chosen per call.
+// The generators are nested: g_t(x) = g_t-1(x) * (x - alpha^(t - 1)), so every codeword encoded with t parity
+// symbols also passes the checks of any smaller parity length, and the syndromes of a smaller length are a prefix
+// of those of a larger one. All generators are built incrementally into one triangular table, and a single
+// decoder for the maximum parity length decodes every smaller one from its first t syndromes.
+class RateCompatibleCodec
+{
+    const GaloisField   m_GaloisField;
+    const ReedSolomon   m_Codec;        // Maximum parity length, decodes every nested code
+    std::vector<RSWord> m_Generators;   // Row t - 1 holds the t + 1 coefficients of g_t, highest first
+    
+    void CheckNumberOfErrorCorrectingSymbols(uint64_t numOfErrorCorrectingSymbols) const;
+    
+public:
+    RateCompatibleCodec(uint64_t bitsPerWord, uint64_t maxNumOfErrorCorrectingSymbols);
+    
+    // The codec points to the shared field
+    RateCompatibleCodec(const RateCompatibleCodec&) = delete;
+    RateCompatibleCodec& operator=(const RateCompatibleCodec&) = delete;
+    
+    // Generator for one parity length, highest coefficient first, throws if it exceeds the maximum
+    [[nodiscard]] std::span<const RSWord> GetGeneratorPolynomial(uint64_t numOfErrorCorrectingSymbols) const;
+    
+    [[nodiscard]] std::vector<RSWord> Encode(const std::vector<RSWord>& message, uint64_t numOfErrorCorrectingSymbols) const;
+    void CalculateParity(const RSWord*message, uint64_t length, RSWord*parity, uint64_t numOfErrorCorrectingSymbols) const;
+    
+    std::vector<RSWord> Decode(const std::vector<RSWord>& data, uint64_t numOfErrorCorrectingSymbols, const std::vector<uint64_t>*erasurePositions = nullptr, uint64_t*numOfErrorsFound = nullptr) const;
+    uint64_t DecodeInPlace(std::span<RSWord> codeword, uint64_t numOfErrorCorrectingSymbols, const std::vector<uint64_t>*erasurePositions = nullptr, std::vector<Correction>*corrections = nullptr) const;
+    
+    [[nodiscard]] bool IsMessageCorrupted(const std::vector<RSWord>& message, uint64_t numOfErrorCorrectingSymbols) const;
+    
+    [[nodiscard]] const GaloisField& GetGaloisField() const noexcept { return m_GaloisField; }
+    [[nodiscard]] uint64_t GetMaxNumberOfErrorCorrectingSymbols() const noexcept { return m_Codec.m_NumOfErrorCorrectingSymbols; }
+};
+}
+
+#endif /* RateCompatibleCodec_hpp */
@@ -42,14 +42,63 @@ the following restrictions:
 #include <type_traits>
 #include <algorithm>
 #include <vector>
+#include <span>
+#include <array>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+#include <deque>
+#include <memory>
+#include <functional>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <future>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <filesystem>
+#include <list>
+#include <unordered_map>
+#include <map>
+#include <exception>
+#include <bit>
+#include <cmath>
+#include <memory_resource>
+#include <optional>
+#include <coroutine>
 
 // Lib includes
 #include "ReedSolomonVersion.hpp"
 #include "Utils.hpp"
+#include "AlignedMemory.hpp"
 #include "GaloisField.hpp"
+#include "GaloisFieldGFNI.hpp"
 #include "Polynomial.hpp"
+#include "InlinePolynomial.hpp"
 #include "ReedSolomonImpl.hpp"
 #include "DataChunker.hpp"
+#include "ThreadPool.hpp"
+#include "CodecService.hpp"
+#include "IncrementalEncoder.hpp"
+#include "BitslicedEncoder.hpp"
+#include "CRC32C.hpp"
+#include "ProtectedContainer.hpp"
+#include "SubBlockCodec.hpp"
+#include "Scrubber.hpp"
+#include "IoUring.hpp"
+#include "AsyncFilePipeline.hpp"
+#include "AdditiveFFTCodec.hpp"
+#include "TowerField.hpp"
+#include "RateCompatibleCodec.hpp"
+#include "AdaptiveProtection.hpp"
+#include "SyndromeAccumulator.hpp"
+#include "PacketFec.hpp"
+#include "ProductCode.hpp"
+#include "JitEncoder.hpp"
+#include "NumaEncoder.hpp"
+#include "AsyncCodec.hpp"
 
 // Namespace alias
 namespace RS = NReedSolomon;
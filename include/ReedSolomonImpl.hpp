@@ -38,6 +38,13 @@ the following restrictions:
 
 namespace NReedSolomon
 {
+// Symbol changed by DecodeInPlace: codeword[position] ^= magnitude
+struct Correction
+{
+    uint64_t    position = 0;
+    RSWord      magnitude = 0;
+};
+
 class ReedSolomon
 {
 public:
@@ -45,36 +52,92 @@ public:
     const uint64_t          m_NumOfErrorCorrectingSymbols = 0;
 
     const GaloisField*      m_GaloisField = nullptr;
+    bool                    m_OwnsGaloisField = true;
     Polynomial*             m_GeneratorPolynomial = nullptr;
 
     // Methods
     void        CreateGeneratorPolynomial() const;
 
     // Syndromes
-    [[nodiscard]] Polynomial  CalculateSyndromes(const Polynomial& message) const;
-    Polynomial  CalculateForneySyndromes(const Polynomial& syndromes, const std::vector<uint64_t>*erasurePositions, uint64_t n) const;
-    [[nodiscard]] bool        CheckSyndromes(const Polynomial& syndromes) const;
+    // Decoder internals work on InlinePolynomial: all of them have at most nsym + 1 coefficients, no heap needed
+    [[nodiscard]] InlinePolynomial  CalculateSyndromes(const Polynomial& message) const;
+    InlinePolynomial  CalculateForneySyndromes(const InlinePolynomial& syndromes, const std::vector<uint64_t>*erasurePositions, uint64_t n) const;
+    [[nodiscard]] bool        CheckSyndromes(const InlinePolynomial& syndromes) const;
+    
+    // Allocation free syndromes, syndromes[i] = data(alpha^i) for i < number of error correcting symbols
+    void        CalculateSyndromes(const RSWord*data, uint64_t length, RSWord*syndromes) const;
+    
+    // Syndromes of the first numOfSyndromes roots only, which are those of the nested code with that many
+    // error correcting symbols
+    void        CalculateSyndromes(const RSWord*data, uint64_t length, RSWord*syndromes, uint64_t numOfSyndromes) const;
+    
+    // Scatter-gather: syndromes of the concatenation of all fragments, nothing is copied
+    void        CalculateSyndromes(std::span<const std::span<const RSWord>> fragments, RSWord*syndromes) const;
+    
+    // Continues the syndromes of a prefix with the following symbols
+    void        AccumulateSyndromes(const RSWord*data, uint64_t length, RSWord*syndromes) const;
+    void        AccumulateSyndromes(const RSWord*data, uint64_t length, RSWord*syndromes, uint64_t numOfSyndromes) const;
 
     // Erasure
-    [[nodiscard]] Polynomial  CalculateErasureLocatorPolynomial(const std::vector<uint64_t>& erasurePositions) const;
-    [[nodiscard]] Polynomial  CalculateErrorEvaluatorPolynomial(const Polynomial& syndromes, const Polynomial& erasureLocatorPolynomial, uint64_t n) const;
-    [[nodiscard]] Polynomial  CorrectErasures(const Polynomial& message, const Polynomial& syndromes, const std::vector<uint64_t>& erasurePositions) const;
+    [[nodiscard]] InlinePolynomial  CalculateErasureLocatorPolynomial(std::span<const uint64_t> erasurePositions) const;
+    [[nodiscard]] InlinePolynomial  CalculateErrorEvaluatorPolynomial(const InlinePolynomial& syndromes, const InlinePolynomial& erasureLocatorPolynomial, uint64_t n) const;
+    [[nodiscard]] Polynomial  CorrectErasures(Polynomial message, const InlinePolynomial& syndromes, const std::vector<uint64_t>& erasurePositions) const;
+    void        CalculateErrorMagnitudes(const InlinePolynomial& syndromes, std::span<const uint64_t> erasurePositions, uint64_t n, RSWord*magnitudes) const;
 
     // Error
-    Polynomial  CalculateErrorLocatorPolynomial(const Polynomial &syndromes, uint64_t n, const Polynomial *erasureLocatorPolynomial, uint64_t erasureCount) const;
-    [[nodiscard]] std::vector<uint64_t> FindErrors(const Polynomial &errorLocatorPolynomial,
-                                                   uint64_t messageLength) const;
+    InlinePolynomial  CalculateErrorLocatorPolynomial(const InlinePolynomial &syndromes, uint64_t n, const InlinePolynomial *erasureLocatorPolynomial, uint64_t erasureCount) const;
+    [[nodiscard]] std::pmr::vector<uint64_t> FindErrors(const InlinePolynomial &errorLocatorPolynomial,
+                                                        uint64_t messageLength,
+                                                        std::pmr::memory_resource*resource = std::pmr::get_default_resource()) const;
 
     ReedSolomon(uint64_t bitsPerWord, uint64_t numOfErrorCorrectingSymbols);
+    
+    // Shares the caller's field tables instead of creating its own, the field must outlive the codec
+    ReedSolomon(const GaloisField& galoisField, uint64_t numOfErrorCorrectingSymbols);
     ReedSolomon(const ReedSolomon& other);
+    ReedSolomon(ReedSolomon&& other) noexcept;
     ReedSolomon& operator=(const ReedSolomon& other) = delete;
     const ReedSolomon& operator=(const ReedSolomon& other) const = delete;
     ~ReedSolomon();
 
     [[nodiscard]] std::vector<RSWord> Encode(const std::vector<RSWord>& message) const;
+    
+    // Codeword allocated from resource, e.g. a std::pmr::monotonic_buffer_resource per request or batch
+    [[nodiscard]] std::pmr::vector<RSWord> Encode(std::span<const RSWord> message, std::pmr::memory_resource*resource) const;
+    
+    // Allocation free encoder, writes the error correction symbols of message into parity
+    void CalculateParity(const RSWord*message, uint64_t length, RSWord*parity) const;
+    
+    // Scatter-gather encoder: parity of the concatenation of all fragments, nothing is copied
+    void CalculateParity(std::span<const std::span<const RSWord>> fragments, RSWord*parity) const;
+    
+    // Continues the remainder of a message prefix in parity with the following symbols
+    void AccumulateParity(const RSWord*message, uint64_t length, RSWord*parity) const;
+    
+    // Same with another monic generator of this field (highest coefficient first), parity holds generator.size() - 1 symbols
+    void AccumulateParity(const RSWord*message, uint64_t length, RSWord*parity, std::span<const RSWord> generator) const;
+    
     std::vector<RSWord> Decode(const std::vector<RSWord>& data, const std::vector<uint64_t>*erasurePositions = nullptr, uint64_t*numOfErrorsFound = nullptr) const;
+    
+    // Message allocated from resource. Apart from it the decoder does not allocate.
+    std::pmr::vector<RSWord> Decode(std::span<const RSWord> data, std::pmr::memory_resource*resource, const std::vector<uint64_t>*erasurePositions = nullptr, uint64_t*numOfErrorsFound = nullptr) const;
+    
+    // Corrects the codeword in the caller's buffer, returns the number of errors found (erasures not counted).
+    // Clean codewords are not written to, otherwise only the corrected symbols are.
+    uint64_t DecodeInPlace(std::span<RSWord> codeword, const std::vector<uint64_t>*erasurePositions = nullptr, std::vector<Correction>*corrections = nullptr) const;
+    
+    // Decodes a codeword of the nested code with 1 <= numOfErrorCorrectingSymbols <= m_NumOfErrorCorrectingSymbols,
+    // whose generator has the first numOfErrorCorrectingSymbols roots of this one (RateCompatibleCodec)
+    uint64_t DecodeInPlace(std::span<RSWord> codeword, uint64_t numOfErrorCorrectingSymbols, const std::vector<uint64_t>*erasurePositions, std::vector<Correction>*corrections) const;
+    
+    // Erasure only decoding, skips Berlekamp-Massey and the Chien search. Erasure positions must be distinct.
+    // Returns false and leaves the codeword unchanged if the syndromes show errors outside of the erasures.
+    bool DecodeErasuresInPlace(std::span<RSWord> codeword, const std::vector<uint64_t>& erasurePositions, std::vector<Correction>*corrections = nullptr) const;
 
     [[nodiscard]] bool IsMessageCorrupted(const std::vector<RSWord>& message) const;
+    
+    // Scatter-gather check of a codeword split into fragments (e.g. header, payload and parity buffers)
+    [[nodiscard]] bool IsMessageCorrupted(std::span<const std::span<const RSWord>> fragments) const;
 
     // Version info
     [[nodiscard]] int32_t GetVersionMajor()const{ return RS_VERSION_MAJOR; } // NOLINT(*-convert-member-functions-to-static)
@@ -0,0 +1,98 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  Scrubber.hpp                                                    */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#ifndef Scrubber_hpp
+#define Scrubber_hpp
+
+namespace NReedSolomon
+{
+// Thread-safe limiter for bytes and operations per second (0 = unlimited).
+// Every request reserves the next free time slot and sleeps until its slot begins,
+// so the rate holds across all threads without a refill thread.
+class RateLimiter
+{
+    const uint64_t                          m_MaxBytesPerSecond = 0;
+    const uint64_t                          m_MaxOperationsPerSecond = 0;
+    
+    std::mutex                              m_Mutex;
+    std::chrono::steady_clock::time_point   m_NextSlot;
+    
+public:
+    RateLimiter(uint64_t maxBytesPerSecond, uint64_t maxOperationsPerSecond);
+    
+    // Blocks until one operation of numOfBytes may start
+    void Acquire(uint64_t numOfBytes);
+};
+
+struct ScrubberSettings
+{
+    uint64_t    numOfThreads = 0;               // Zero selects std::thread::hardware_concurrency()
+    uint64_t    maxBytesPerSecond = 0;          // Stored bytes read and written by repairs, 0 = unlimited
+    uint64_t    maxOperationsPerSecond = 0;     // Chunk reads and repair writes, 0 = unlimited
+    bool        repair = true;
+};
+
+struct ScrubFileReport
+{
+    std::filesystem::path   path;
+    ContainerScrubReport    report;
+    std::string             error;  // Set if the file could not be scrubbed
+};
+
+// Verifies (and repairs) container files of both layouts on a worker pool. All workers scrub one file at a time,
+// each with its own file handle, claiming chunks from a shared counter.
+class Scrubber
+{
+    const ScrubberSettings  m_Settings;
+    RateLimiter             m_RateLimiter;
+    std::atomic<bool>       m_IsCancelled = false;
+    ThreadPool              m_ThreadPool; // Declared last: joined before the limiter is destroyed
+    
+    [[nodiscard]] ContainerScrubReport ScrubFile(const std::filesystem::path& path);
+    
+public:
+    explicit Scrubber(const ScrubberSettings& settings = {});
+    
+    Scrubber(const Scrubber&) = delete;
+    Scrubber& operator=(const Scrubber&) = delete;
+    
+    // Blocking, files are scrubbed one after another
+    [[nodiscard]] std::vector<ScrubFileReport> Scrub(const std::vector<std::filesystem::path>& files);
+    
+    // Stops a running Scrub() after the chunks in flight, may be called from any thread.
+    // Also applies to Scrub() calls starting later, a cancelled scrubber stays cancelled.
+    void Cancel() noexcept { m_IsCancelled = true; }
+};
+}
+
+#endif /* Scrubber_hpp */
@@ -0,0 +1,73 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  SyndromeAccumulator.hpp                                         */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#ifndef SyndromeAccumulator_hpp
+#define SyndromeAccumulator_hpp
+
+namespace NReedSolomon
+{
+// Syndromes of a codeword that arrives in pieces. Every symbol or fragment is folded into all nsym syndromes
+// as it arrives (Horner's scheme per root), so the clean/corrupt verdict is ready in O(nsym) after the last
+// symbol, without a second pass over the received buffer.
+//
+// With the GFNI backend the syndromes stay in the hardware domain between calls and one symbol updates 32 roots
+// per instruction, only GetSyndromes() maps them back. Zero is zero in both domains, so IsCorrupted() does not.
+class SyndromeAccumulator
+{
+    const ReedSolomon*  m_ReedSolomon = nullptr;
+    const bool          m_UseGFNI = false;
+    uint64_t            m_Length = 0;
+    
+    alignas(32) std::array<RSWord, InlinePolynomial::Capacity> m_Syndromes{};
+    alignas(32) std::array<RSWord, InlinePolynomial::Capacity> m_Roots{}; // alpha^i in the hardware domain (GFNI only)
+    
+public:
+    explicit SyndromeAccumulator(const ReedSolomon& reedSolomon);
+    
+    // Starts a new codeword
+    void Reset();
+    
+    void Update(RSWord symbol);
+    void Update(std::span<const RSWord> fragment);
+    
+    [[nodiscard]] bool IsCorrupted() const;
+    
+    // syndromes[i] = codeword(alpha^i), same as ReedSolomon::CalculateSyndromes() over all symbols so far
+    void GetSyndromes(RSWord*syndromes) const;
+    
+    // Number of symbols received since the last reset
+    [[nodiscard]] uint64_t GetLength() const noexcept { return m_Length; }
+};
+}
+
+#endif /* SyndromeAccumulator_hpp */
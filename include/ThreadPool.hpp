@@ -0,0 +1,123 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  ThreadPool.hpp                                                  */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#ifndef ThreadPool_hpp
+#define ThreadPool_hpp
+
+namespace NReedSolomon
+{
+class ThreadPool
+{
+    std::vector<std::thread>            m_Workers;
+    std::deque<std::function<void()>>   m_Tasks;
+    
+    std::mutex                          m_Mutex;
+    std::condition_variable             m_Condition;
+    bool                                m_IsStopping = false;
+    
+    void WorkerLoop();
+    void Enqueue(std::function<void()> task);
+    
+public:
+    // Zero threads selects std::thread::hardware_concurrency().
+    // initializeWorker(index) runs on every worker before its first task (e.g. CPU pinning), it must not throw.
+    explicit ThreadPool(uint64_t numOfThreads = 0, const std::function<void(uint64_t)>& initializeWorker = {});
+    ~ThreadPool();
+    
+    // Non copyable, non movable (workers reference this object)
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    
+    // Run a callable on one of the workers, result (or exception) is delivered through the future
+    template <typename Function>
+    auto Submit(Function&& function) -> std::future<std::invoke_result_t<std::decay_t<Function>>>;
+    
+    // Calls function(index) for every index < count on all workers and waits for completion, indices are claimed
+    // one at a time. The first exception is rethrown. Must not be called from a worker of the same pool.
+    template <typename Function>
+    void ParallelFor(uint64_t count, const Function& function);
+
+    [[nodiscard]] uint64_t GetNumberOfThreads() const noexcept { return m_Workers.size(); }
+};
+
+template <typename Function>
+auto ThreadPool::Submit(Function&& function) -> std::future<std::invoke_result_t<std::decay_t<Function>>>
+{
+    using ResultType = std::invoke_result_t<std::decay_t<Function>>;
+    
+    // std::function needs a copyable target, packaged_task is move only
+    auto task = std::make_shared<std::packaged_task<ResultType()>>(std::forward<Function>(function));
+    std::future<ResultType> result = task->get_future();
+    
+    Enqueue([task]() { (*task)(); });
+    
+    return result;
+}
+
+template <typename Function>
+void ThreadPool::ParallelFor(const uint64_t count, const Function& function)
+{
+    std::atomic<uint64_t> next = 0;
+    std::vector<std::future<void>> results;
+    
+    for(uint64_t t = 0; t < std::min<uint64_t>(GetNumberOfThreads(), count); t++)
+    {
+        results.push_back(Submit([&next, count, &function]()
+        {
+            for(uint64_t index = next++; index < count; index = next++)
+                function(index);
+        }));
+    }
+    
+    // Wait for every task before rethrowing, they reference this stack frame
+    std::exception_ptr error;
+    
+    for(std::future<void>& result : results)
+    {
+        try
+        {
+            result.get();
+        }
+        catch(...)
+        {
+            if(!error)
+                error = std::current_exception();
+        }
+    }
+    
+    if(error)
+        std::rethrow_exception(error);
+}
+}
+
+#endif /* ThreadPool_hpp */
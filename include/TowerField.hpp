@@ -0,0 +1,98 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  TowerField.hpp                                                  */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#ifndef TowerField_hpp
+#define TowerField_hpp
+
+namespace NReedSolomon
+{
+// GF(2^16) as the quadratic extension GF((2^8)^2) = GF(2^8)[y] / (y^2 + y + mu) of GaloisField(8).
+// The element a1 * y + a0 is stored as (a1 << 8) | a0. Every operation decomposes into a few lookups in the
+// GF(2^8) log/exp tables (768 bytes), which stay in L1 where flat GF(2^16) log/exp tables take 384 KB.
+//   Multiply: Karatsuba, three GF(2^8) multiplications plus one by the constant mu
+//   Inverse:  conjugate (a1 * y + a0 + a1) divided by the norm a0 * (a0 + a1) + mu * a1^2, which lies in GF(2^8)
+//   Regions:  multiplication by a constant is GF(2)-linear in both halves, so two 256 entry tables of
+//             products (1 KB) cover it: factor * x = high[a1] ^ low[a0]. Linearity also builds them from
+//             16 products, a ProductTable can be kept for repeated regions with the same factor.
+//   Log/Exp:  the multiplicative group of order 65535 = 255 * 257 splits into GF(2^8)* and the 257 elements of
+//             norm 1, generated by alpha and u = y^255. Every element is c * u^j with c in GF(2^8): its norm c^2
+//             gives log(c) and the ratio a0 / a1 identifies u^j, so logarithms to g = alpha * u need 1 KB of tables.
+class TowerField
+{
+    const GaloisField       m_BaseField;
+    RSWord                  m_Mu = 0;   // Smallest mu with trace 1, which makes y^2 + y + mu irreducible
+    alignas(CacheLineSize) std::array<RSWord, 256> m_MultiplyByMu{};
+    std::array<RSWord16, 257>   m_UnitPowers{};     // u^j
+    std::array<uint16_t, 256>   m_UnitLogarithms{}; // j of u^j by a0 / a1 (u^0 = 1 is the only one with a1 = 0)
+    
+    void FindMu();
+    void PrecomputeLogarithmTables();
+    
+public:
+    static constexpr uint64_t Cardinality = 65536;
+    static constexpr uint64_t Modulus = Cardinality - 1; // Order of the multiplicative group
+    
+    // Products of a factor with every high and low half
+    struct ProductTable
+    {
+        alignas(CacheLineSize) std::array<RSWord16, 256> high{};
+        alignas(CacheLineSize) std::array<RSWord16, 256> low{};
+    };
+    
+    explicit TowerField(bool allowHardwareAcceleration = true);
+    
+    [[nodiscard]] RSWord16 Add(RSWord16 x, RSWord16 y) const noexcept;
+    [[nodiscard]] RSWord16 Subtract(RSWord16 x, RSWord16 y) const noexcept;
+    [[nodiscard]] RSWord16 Multiply(RSWord16 x, RSWord16 y) const;
+    [[nodiscard]] RSWord16 Divide(RSWord16 x, RSWord16 y) const;
+    [[nodiscard]] RSWord16 Pow(RSWord16 x, uint64_t power) const;
+    [[nodiscard]] RSWord16 Inverse(RSWord16 x) const;
+    
+    // Discrete logarithm and power of the generator alpha * u, Log(Exp(k)) = k mod Modulus
+    [[nodiscard]] uint32_t Log(RSWord16 x) const;
+    [[nodiscard]] RSWord16 Exp(uint64_t power) const;
+    
+    [[nodiscard]] ProductTable GetProductTable(RSWord16 factor) const;
+    
+    // Bulk operations: destination = factor * source, destination += factor * source
+    void MultiplyRegion(RSWord16*destination, const RSWord16*source, RSWord16 factor, uint64_t length) const;
+    void MultiplyAccumulate(RSWord16*destination, const RSWord16*source, RSWord16 factor, uint64_t length) const;
+    void MultiplyRegion(RSWord16*destination, const RSWord16*source, const ProductTable& table, uint64_t length) const;
+    void MultiplyAccumulate(RSWord16*destination, const RSWord16*source, const ProductTable& table, uint64_t length) const;
+    
+    [[nodiscard]] const GaloisField& GetBaseField() const noexcept { return m_BaseField; }
+    [[nodiscard]] RSWord GetMu() const noexcept { return m_Mu; }
+};
+}
+
+#endif /* TowerField_hpp */
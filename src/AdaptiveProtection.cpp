@@ -0,0 +1,161 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  AdaptiveProtection.cpp                                          */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#include "ReedSolomon.hpp"
+
+using namespace NReedSolomon;
+
+AdaptiveProtectionController::AdaptiveProtectionController(const AdaptiveProtectionSettings& settings)
+    : m_Settings(settings)
+{
+    if(m_Settings.minNumOfErrorCorrectingSymbols < 1 || m_Settings.minNumOfErrorCorrectingSymbols > m_Settings.maxNumOfErrorCorrectingSymbols)
+        throw std::invalid_argument("Invalid range of error correcting symbols.");
+    
+    if(m_Settings.windowSize < 1)
+        throw std::invalid_argument("Window size must be greater than zero.");
+    
+    if(!(m_Settings.targetFailureProbability > 0.0 && m_Settings.targetFailureProbability < 1.0))
+        throw std::invalid_argument("Target failure probability must be between 0 and 1.");
+}
+
+void AdaptiveProtectionController::Record(const Observation& observation)
+{
+    std::lock_guard lock(m_Mutex);
+    
+    m_Window.push_back(observation);
+    m_Statistics.numOfCodewords++;
+    m_Statistics.numOfSymbols += observation.numOfSymbols;
+    m_Statistics.numOfErrors += observation.numOfErrors;
+    m_Statistics.numOfFailures += observation.failed ? 1 : 0;
+    
+    if(m_Window.size() > m_Settings.windowSize)
+    {
+        const Observation& oldest = m_Window.front();
+        
+        m_Statistics.numOfCodewords--;
+        m_Statistics.numOfSymbols -= oldest.numOfSymbols;
+        m_Statistics.numOfErrors -= oldest.numOfErrors;
+        m_Statistics.numOfFailures -= oldest.failed ? 1 : 0;
+        
+        m_Window.pop_front();
+    }
+}
+
+void AdaptiveProtectionController::RecordDecode(const uint64_t codewordLength, const uint64_t numOfErrorsFound)
+{
+    Record({codewordLength, numOfErrorsFound, false});
+}
+
+void AdaptiveProtectionController::RecordFailure(const uint64_t codewordLength, const uint64_t numOfErrorCorrectingSymbols)
+{
+    // Lower bound, the actual number of errors is unknown
+    Record({codewordLength, numOfErrorCorrectingSymbols / 2 + 1, true});
+}
+
+// Caller holds the mutex
+double AdaptiveProtectionController::GetSymbolErrorRate() const
+{
+    return std::min(1.0, static_cast<double>(m_Statistics.numOfErrors + 1) / static_cast<double>(m_Statistics.numOfSymbols + 1));
+}
+
+double AdaptiveProtectionController::CalculateFailureProbability(const uint64_t n, const uint64_t numOfCorrectableErrors, const double symbolErrorRate)
+{
+    if(numOfCorrectableErrors >= n || symbolErrorRate <= 0.0)
+        return 0.0;
+    
+    if(symbolErrorRate >= 1.0)
+        return 1.0;
+    
+    // Sum the tail from its first term, log(P(X = i)) is updated incrementally
+    const double N = static_cast<double>(n);
+    const double logP = std::log(symbolErrorRate);
+    const double logQ = std::log1p(-symbolErrorRate);
+    const double mode = N * symbolErrorRate;
+    
+    uint64_t i = numOfCorrectableErrors + 1;
+    double logTerm = std::lgamma(N + 1.0) - std::lgamma(static_cast<double>(i) + 1.0) - std::lgamma(N - static_cast<double>(i) + 1.0)
+                   + static_cast<double>(i) * logP + (N - static_cast<double>(i)) * logQ;
+    double sum = 0.0;
+    
+    for(; i <= n; i++)
+    {
+        const double term = std::exp(logTerm);
+        sum += term;
+        
+        // Past the mode the terms only shrink
+        if(static_cast<double>(i) > mode && term < sum * 1e-12)
+            break;
+        
+        logTerm += std::log((N - static_cast<double>(i)) / static_cast<double>(i + 1)) + logP - logQ;
+    }
+    
+    return std::min(1.0, sum);
+}
+
+double AdaptiveProtectionController::EstimateFailureProbability(const uint64_t messageLength, const uint64_t numOfErrorCorrectingSymbols) const
+{
+    std::lock_guard lock(m_Mutex);
+    return CalculateFailureProbability(messageLength + numOfErrorCorrectingSymbols, numOfErrorCorrectingSymbols / 2, GetSymbolErrorRate());
+}
+
+uint64_t AdaptiveProtectionController::Recommend(const uint64_t messageLength) const
+{
+    std::lock_guard lock(m_Mutex);
+    const double symbolErrorRate = GetSymbolErrorRate();
+    
+    for(uint64_t nsym = m_Settings.minNumOfErrorCorrectingSymbols; nsym < m_Settings.maxNumOfErrorCorrectingSymbols; nsym++)
+    {
+        if(CalculateFailureProbability(messageLength + nsym, nsym / 2, symbolErrorRate) <= m_Settings.targetFailureProbability)
+            return nsym;
+    }
+    
+    return m_Settings.maxNumOfErrorCorrectingSymbols;
+}
+
+AdaptiveProtectionStatistics AdaptiveProtectionController::GetStatistics() const
+{
+    std::lock_guard lock(m_Mutex);
+    
+    AdaptiveProtectionStatistics statistics = m_Statistics;
+    statistics.symbolErrorRate = GetSymbolErrorRate();
+    
+    return statistics;
+}
+
+void AdaptiveProtectionController::Reset()
+{
+    std::lock_guard lock(m_Mutex);
+    
+    m_Window.clear();
+    m_Statistics = {};
+}
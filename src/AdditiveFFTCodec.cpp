@@ -0,0 +1,321 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  AdditiveFFTCodec.cpp                                            */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#include "ReedSolomon.hpp"
+
+using namespace NReedSolomon;
+
+namespace
+{
+constexpr uint32_t Modulus = TowerField::Modulus; // Order of the multiplicative group
+
+// Shared by all codecs, its tables take about 2 KB where flat GF(2^16) log/exp tables take 384 KB
+const TowerField& GetField()
+{
+    static const TowerField field;
+    return field;
+}
+
+uint32_t AddModulo(const uint32_t x, const uint32_t y)
+{
+    const uint32_t sum = x + y;
+    return sum >= Modulus ? sum - Modulus : sum;
+}
+
+uint32_t SubtractModulo(const uint32_t x, const uint32_t y)
+{
+    return x >= y ? x - y : x + Modulus - y;
+}
+
+// Walsh-Hadamard transform with arithmetic modulo 2^16 - 1, its own inverse up to a factor of size
+void WalshHadamardTransform(uint32_t* const data, const uint64_t size)
+{
+    for(uint64_t half = 1; half < size; half *= 2)
+    {
+        for(uint64_t block = 0; block < size; block += 2 * half)
+        {
+            for(uint64_t i = block; i < block + half; i++)
+            {
+                const uint32_t x = data[i];
+                const uint32_t y = data[i + half];
+                
+                data[i] = AddModulo(x, y);
+                data[i + half] = SubtractModulo(x, y);
+            }
+        }
+    }
+}
+}
+
+AdditiveFFTCodec::AdditiveFFTCodec(const uint64_t messageLength, const uint64_t numOfErrorCorrectingSymbols)
+    : m_MessageLength(messageLength)
+    , m_NumOfErrorCorrectingSymbols(numOfErrorCorrectingSymbols)
+{
+    if(messageLength == 0 || numOfErrorCorrectingSymbols == 0)
+        throw std::invalid_argument("Message length and number of error correcting symbols must not be zero.");
+    
+    if(numOfErrorCorrectingSymbols > MaxCodewordLength || messageLength > MaxCodewordLength)
+        throw std::invalid_argument("Codeword is too long for GF(2^16).");
+    
+    m_ChunkSize = std::bit_ceil(numOfErrorCorrectingSymbols);
+    
+    if(m_ChunkSize + messageLength > MaxCodewordLength)
+        throw std::invalid_argument("Codeword is too long for GF(2^16).");
+    
+    m_TransformSize = std::bit_ceil(m_ChunkSize + messageLength);
+    
+    PrecomputeTables();
+}
+
+void AdditiveFFTCodec::PrecomputeTables()
+{
+    // Subspace polynomial s_j vanishes on all points < 2^j: s_0(y) = y, s_j+1(y) = s_j(y) * (s_j(y) + s_j(2^j)).
+    // It is linear, so s_j at any point follows from its values at the basis points 2^b.
+    const TowerField& field = GetField();
+    
+    std::array<RSWord16, FieldBits> subspace{};
+    for(uint64_t b = 0; b < FieldBits; b++)
+        subspace[b] = static_cast<RSWord16>(1U << b);
+    
+    // The linear coefficient of s_j is the product of s_l(2^l), l < j
+    RSWord16 linearCoefficient = 1;
+    
+    for(uint64_t j = 0; j < FieldBits; j++)
+    {
+        const RSWord16 pivot = subspace[j];
+        
+        for(uint64_t b = 0; b < FieldBits; b++)
+            m_Skews[j][b] = field.Divide(subspace[b], pivot);
+        
+        m_DerivativeFactors[j] = field.Divide(linearCoefficient, pivot);
+        linearCoefficient = field.Multiply(linearCoefficient, pivot);
+        
+        for(uint64_t b = 0; b < FieldBits; b++)
+            subspace[b] = field.Multiply(subspace[b], subspace[b] ^ pivot);
+    }
+    
+    // Locator logarithms are a convolution over XOR of the erasure indicator with log(omega_i).
+    // log(0) = 0 drops the erasure itself from the sum, which turns the locator into its derivative there.
+    m_LogWalsh.resize(m_TransformSize);
+    for(uint64_t i = 1; i < m_TransformSize; i++)
+        m_LogWalsh[i] = field.Log(static_cast<RSWord16>(i));
+    
+    WalshHadamardTransform(m_LogWalsh.data(), m_TransformSize);
+}
+
+RSWord16 AdditiveFFTCodec::GetSkew(const uint64_t layer, const uint64_t point) const
+{
+    RSWord16 skew = 0;
+    
+    // The point is a multiple of 2^(layer + 1), lower basis points do not contribute
+    for(uint64_t b = layer + 1; b < FieldBits; b++)
+    {
+        if((point >> b) & 1)
+            skew ^= m_Skews[layer][b];
+    }
+    
+    return skew;
+}
+
+// D(x) = D0(x) + s_j(x) * D1(x), where s_j is constant on both halves of a block and differs by exactly 1
+void AdditiveFFTCodec::FFT(RSWord16* const data, const uint64_t size, const uint64_t offset) const
+{
+    const TowerField& field = GetField();
+    
+    for(uint64_t layer = std::countr_zero(size); layer-- > 0;)
+    {
+        const uint64_t half = uint64_t(1) << layer;
+        
+        for(uint64_t block = 0; block < size; block += 2 * half)
+        {
+            field.MultiplyAccumulate(data + block, data + block + half, GetSkew(layer, offset + block), half);
+            
+            for(uint64_t i = block; i < block + half; i++)
+                data[i + half] ^= data[i];
+        }
+    }
+}
+
+void AdditiveFFTCodec::IFFT(RSWord16* const data, const uint64_t size, const uint64_t offset) const
+{
+    const TowerField& field = GetField();
+    const uint64_t numOfLayers = std::countr_zero(size);
+    
+    for(uint64_t layer = 0; layer < numOfLayers; layer++)
+    {
+        const uint64_t half = uint64_t(1) << layer;
+        
+        for(uint64_t block = 0; block < size; block += 2 * half)
+        {
+            for(uint64_t i = block; i < block + half; i++)
+                data[i + half] ^= data[i];
+            
+            field.MultiplyAccumulate(data + block, data + block + half, GetSkew(layer, offset + block), half);
+        }
+    }
+}
+
+// Basis polynomial X_i is the product of the normalized s_j for the bits j of i, so by the product rule
+// X_i' is the sum of s_j' * X_(i without bit j). Per bit j that is one region per block with the factor s_j',
+// so its product table is built once for all blocks.
+void AdditiveFFTCodec::FormalDerivative(const RSWord16* const coefficients, RSWord16* const derivative, const uint64_t size) const
+{
+    const TowerField& field = GetField();
+    
+    std::fill(derivative, derivative + size, 0);
+    
+    for(uint64_t j = 0; (uint64_t(1) << j) < size; j++)
+    {
+        const uint64_t half = uint64_t(1) << j;
+        const TowerField::ProductTable table = field.GetProductTable(m_DerivativeFactors[j]);
+        
+        for(uint64_t block = 0; block < size; block += 2 * half)
+            field.MultiplyAccumulate(derivative + block, coefficients + block + half, table, half);
+    }
+}
+
+std::vector<RSWord16> AdditiveFFTCodec::Encode(const std::span<const RSWord16> message) const
+{
+    if(message.size() != m_MessageLength)
+        throw std::invalid_argument("Message length does not match the codec.");
+    
+    // Codeword = message followed by its parity
+    std::vector<RSWord16> codeword(m_MessageLength + m_NumOfErrorCorrectingSymbols);
+    std::ranges::copy(message, codeword.begin());
+    
+    CalculateParity(message.data(), codeword.data() + m_MessageLength);
+    
+    return codeword;
+}
+
+// The codeword is in the code iff the coefficients of all chunks, each interpolated on its own coset,
+// sum up to zero. The parity chunk is therefore the FFT of the sum over the message chunks.
+void AdditiveFFTCodec::CalculateParity(const RSWord16* const message, RSWord16* const parity) const
+{
+    std::vector<RSWord16> sum(m_ChunkSize, 0);
+    std::vector<RSWord16> chunk(m_ChunkSize);
+    
+    for(uint64_t first = 0; first < m_MessageLength; first += m_ChunkSize)
+    {
+        const uint64_t count = std::min(m_ChunkSize, m_MessageLength - first);
+        
+        std::copy(message + first, message + first + count, chunk.begin());
+        std::fill(chunk.begin() + static_cast<coef_diff_type>(count), chunk.end(), 0);
+        
+        IFFT(chunk.data(), m_ChunkSize, m_ChunkSize + first);
+        
+        for(uint64_t i = 0; i < m_ChunkSize; i++)
+            sum[i] ^= chunk[i];
+    }
+    
+    FFT(sum.data(), m_ChunkSize, 0);
+    
+    // Parity beyond nsym is never stored and always treated as erased
+    std::copy(sum.begin(), sum.begin() + static_cast<coef_diff_type>(m_NumOfErrorCorrectingSymbols), parity);
+}
+
+void AdditiveFFTCodec::DecodeErasures(const std::span<RSWord16> codeword, const std::vector<uint64_t>& erasurePositions) const
+{
+    if(codeword.size() != GetCodewordLength())
+        throw std::invalid_argument("Codeword length does not match the codec.");
+    
+    if(erasurePositions.size() > m_NumOfErrorCorrectingSymbols)
+        throw std::runtime_error("Too many erasures to correct.");
+    
+    if(erasurePositions.empty())
+        return;
+    
+    const uint64_t n = m_TransformSize;
+    const TowerField& field = GetField();
+    
+    // Codeword position -> transform point
+    auto toPoint = [this](const uint64_t position)
+    {
+        return position < m_MessageLength ? m_ChunkSize + position : position - m_MessageLength;
+    };
+    
+    std::vector<uint32_t> logLocator(n, 0);
+    
+    for(uint64_t point = m_NumOfErrorCorrectingSymbols; point < m_ChunkSize; point++)
+        logLocator[point] = 1;
+    
+    for(const uint64_t position : erasurePositions)
+    {
+        if(position >= codeword.size())
+            throw std::out_of_range("Erasure position is out of range.");
+        
+        logLocator[toPoint(position)] = 1;
+    }
+    
+    std::vector<uint8_t> erased(n);
+    for(uint64_t i = 0; i < n; i++)
+        erased[i] = static_cast<uint8_t>(logLocator[i]);
+    
+    // log(locator(omega_i)) = sum over erasures e of log(omega_i + omega_e), 1 / n = 2^(16 - log2(n)) modulo 2^16 - 1
+    WalshHadamardTransform(logLocator.data(), n);
+    
+    for(uint64_t i = 0; i < n; i++)
+        logLocator[i] = static_cast<uint32_t>(uint64_t(logLocator[i]) * m_LogWalsh[i] % Modulus);
+    
+    WalshHadamardTransform(logLocator.data(), n);
+    
+    const uint64_t inverseSize = (uint64_t(1) << (FieldBits - std::countr_zero(n))) % Modulus;
+    for(uint64_t i = 0; i < n; i++)
+        logLocator[i] = static_cast<uint32_t>(logLocator[i] * inverseSize % Modulus);
+    
+    // G = codeword polynomial * locator, known at every point since it vanishes at the erasures
+    std::vector<RSWord16> work(n, 0);
+    
+    for(uint64_t position = 0; position < codeword.size(); position++)
+    {
+        const uint64_t point = toPoint(position);
+        
+        if(!erased[point] && codeword[position] != 0)
+            work[point] = field.Multiply(codeword[position], field.Exp(logLocator[point]));
+    }
+    
+    // G'(omega_e) = F(omega_e) * locator'(omega_e) at every erasure
+    std::vector<RSWord16> derivative(n);
+    
+    IFFT(work.data(), n, 0);
+    FormalDerivative(work.data(), derivative.data(), n);
+    FFT(derivative.data(), n, 0);
+    
+    for(const uint64_t position : erasurePositions)
+    {
+        const uint64_t point = toPoint(position);
+        const RSWord16 value = derivative[point];
+        
+        codeword[position] = field.Multiply(value, field.Exp(Modulus - logLocator[point]));
+    }
+}
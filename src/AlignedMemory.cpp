@@ -0,0 +1,147 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  AlignedMemory.cpp                                               */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#include "ReedSolomon.hpp"
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+using namespace NReedSolomon;
+
+BufferPool::BufferPool(const uint64_t numOfBuffers, const uint64_t bufferSize, const PageMode pageMode, const uint64_t alignment)
+    : m_NumOfBuffers(numOfBuffers)
+    , m_Alignment(alignment)
+{
+    if(numOfBuffers < 1 || bufferSize < 1)
+        throw std::invalid_argument("Buffer pool cannot be empty.");
+    
+    if(!std::has_single_bit(alignment) || alignment > PageSize)
+        throw std::invalid_argument("Alignment must be a power of two not larger than a page.");
+    
+    m_BufferSize = (bufferSize + alignment - 1) / alignment * alignment;
+    m_Size = m_BufferSize * numOfBuffers;
+    
+    // Explicit huge pages fall back to transparent ones, those to regular pages
+    if(pageMode == PageMode::ExplicitHugePages && Map(PageMode::ExplicitHugePages))
+        return;
+    
+    if(pageMode != PageMode::Default && Map(PageMode::TransparentHugePages))
+        return;
+    
+    if(!Map(PageMode::Default))
+        throw std::bad_alloc();
+}
+
+#if defined(__linux__)
+
+bool BufferPool::Map(const PageMode pageMode)
+{
+    const uint64_t pageSize = (pageMode == PageMode::Default) ? PageSize : HugePageSize;
+    const uint64_t size = (m_Size + pageSize - 1) / pageSize * pageSize;
+    
+    if(pageMode == PageMode::ExplicitHugePages)
+    {
+        void* const memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if(memory == MAP_FAILED)
+            return false;
+        
+        m_Memory = static_cast<RSWord*>(memory);
+    }
+    else if(pageMode == PageMode::TransparentHugePages)
+    {
+        // Over-allocate, then cut the mapping down to a huge page aligned range
+        void* const memory = mmap(nullptr, size + HugePageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if(memory == MAP_FAILED)
+            return false;
+        
+        const uint64_t address = reinterpret_cast<uint64_t>(memory);
+        const uint64_t aligned = (address + HugePageSize - 1) / HugePageSize * HugePageSize;
+        
+        if(aligned > address)
+            munmap(memory, aligned - address);
+        
+        if(address + HugePageSize > aligned)
+            munmap(reinterpret_cast<void*>(aligned + size), address + HugePageSize - aligned);
+        
+        m_Memory = reinterpret_cast<RSWord*>(aligned);
+        
+        // Only a hint, without THP support the range keeps regular pages
+        madvise(m_Memory, size, MADV_HUGEPAGE);
+    }
+    else
+    {
+        void* const memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if(memory == MAP_FAILED)
+            return false;
+        
+        m_Memory = static_cast<RSWord*>(memory);
+    }
+    
+    m_Size = size;
+    m_PageMode = pageMode;
+    
+    return true;
+}
+
+BufferPool::~BufferPool()
+{
+    munmap(m_Memory, m_Size);
+}
+
+#else
+
+bool BufferPool::Map(const PageMode pageMode)
+{
+    if(pageMode != PageMode::Default)
+        return false;
+    
+    m_Memory = static_cast<RSWord*>(::operator new(m_Size, std::align_val_t(m_Alignment)));
+    
+    return true;
+}
+
+BufferPool::~BufferPool()
+{
+    ::operator delete(m_Memory, std::align_val_t(m_Alignment));
+}
+
+#endif
+
+RSWord* BufferPool::GetBuffer(const uint64_t index) const
+{
+    if(index >= m_NumOfBuffers)
+        throw std::out_of_range("Buffer index is outside of the pool.");
+    
+    return m_Memory + index * m_BufferSize;
+}
@@ -0,0 +1,256 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  AsyncCodec.cpp                                                  */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#include "ReedSolomon.hpp"
+
+using namespace NReedSolomon;
+
+namespace
+{
+// Number of codewords in codewords laid out back to back, the last one may be shorter
+uint64_t GetNumberOfCodewords(const uint64_t size, const uint64_t codewordLength, const uint64_t nsym)
+{
+    const uint64_t numOfCodewords = (size + codewordLength - 1) / codewordLength;
+    
+    if(size - (numOfCodewords - 1) * codewordLength <= nsym)
+        throw std::invalid_argument("Last codeword is not longer than its parity.");
+    
+    return numOfCodewords;
+}
+}
+
+AsyncCodec::ParallelSteps::ParallelSteps(const AsyncCodec* const asyncCodec, const uint64_t numOfSteps, std::function<void(uint64_t)> function)
+    : m_AsyncCodec(asyncCodec)
+    , m_NumOfSteps(numOfSteps)
+    , m_Function(std::move(function))
+{
+}
+
+void AsyncCodec::ParallelSteps::SetError(std::exception_ptr error)
+{
+    if(!m_HasError.exchange(true))
+        m_Error = std::move(error);
+}
+
+void AsyncCodec::ParallelSteps::FinishSteps(const uint64_t numOfSteps, const std::coroutine_handle<> handle)
+{
+    if(m_Remaining.fetch_sub(numOfSteps, std::memory_order_acq_rel) != numOfSteps)
+        return;
+    
+    const AsyncExecutor& resumeExecutor = m_AsyncCodec->m_ResumeExecutor;
+    
+    if(resumeExecutor)
+        resumeExecutor([handle]() { handle.resume(); });
+    else
+        handle.resume();
+}
+
+void AsyncCodec::ParallelSteps::await_suspend(const std::coroutine_handle<> handle)
+{
+    // The last step resumes the coroutine, which destroys this awaiter: nothing of it may be touched after the
+    // final post, so everything the loop needs is copied first
+    const AsyncExecutor& executor = m_AsyncCodec->m_Executor;
+    const uint64_t numOfSteps = m_NumOfSteps;
+    
+    m_Remaining = numOfSteps;
+    
+    for(uint64_t step = 0; step < numOfSteps; step++)
+    {
+        try
+        {
+            executor([this, handle, step]()
+            {
+                try
+                {
+                    m_Function(step);
+                }
+                catch(...)
+                {
+                    SetError(std::current_exception());
+                }
+                
+                FinishSteps(1, handle);
+            });
+        }
+        catch(...)
+        {
+            // The steps not posted are finished without running, the posted ones cannot resume the coroutine
+            // before they are accounted for. The executor's exception is thrown by await_resume().
+            SetError(std::current_exception());
+            FinishSteps(numOfSteps - step, handle);
+            return;
+        }
+    }
+}
+
+void AsyncCodec::ParallelSteps::await_resume() const
+{
+    if(m_Error)
+        std::rethrow_exception(m_Error);
+}
+
+AsyncCodec::AsyncCodec(std::shared_ptr<const ReedSolomon> codec, AsyncExecutor executor, AsyncExecutor resumeExecutor, const uint64_t chunkSize)
+    : m_Codec(std::move(codec))
+    , m_Executor(std::move(executor))
+    , m_ResumeExecutor(std::move(resumeExecutor))
+    , m_ChunkSize(chunkSize)
+{
+    if(!m_Codec)
+        throw std::invalid_argument("Codec is missing.");
+    
+    if(!m_Executor)
+        throw std::invalid_argument("Executor is missing.");
+    
+    if(m_ChunkSize == 0)
+        throw std::invalid_argument("Chunk size cannot be zero.");
+}
+
+AsyncExecutor AsyncCodec::MakeExecutor(ThreadPool& threadPool)
+{
+    return [&threadPool](std::function<void()> work)
+    {
+        // Steps report their own errors, the future is not needed
+        (void)threadPool.Submit(std::move(work));
+    };
+}
+
+uint64_t AsyncCodec::GetCodewordsPerStep(const uint64_t codewordLength) const
+{
+    return std::max<uint64_t>(1, m_ChunkSize / codewordLength);
+}
+
+AsyncTask<std::vector<RSWord>> AsyncCodec::Encode(std::vector<RSWord> data, const uint64_t messageLength) const
+{
+    const uint64_t nsym = m_Codec->m_NumOfErrorCorrectingSymbols;
+    
+    if(data.empty())
+        throw std::invalid_argument("Cannot encode empty message.");
+    
+    if(messageLength < 1 || messageLength + nsym > (1ULL << m_Codec->m_BitsPerWord) - 1)
+        throw std::invalid_argument("Message length exceeds the maximum codeword length.");
+    
+    const uint64_t codewordLength = messageLength + nsym;
+    const uint64_t numOfCodewords = (data.size() + messageLength - 1) / messageLength;
+    const uint64_t codewordsPerStep = GetCodewordsPerStep(codewordLength);
+    
+    std::vector<RSWord> codewords(data.size() + numOfCodewords * nsym);
+    
+    co_await ParallelSteps(this, (numOfCodewords + codewordsPerStep - 1) / codewordsPerStep, [&](const uint64_t step)
+    {
+        const uint64_t end = std::min(numOfCodewords, (step + 1) * codewordsPerStep);
+        
+        for(uint64_t index = step * codewordsPerStep; index < end; index++)
+        {
+            const uint64_t offset = index * messageLength;
+            const uint64_t length = std::min(messageLength, data.size() - offset);
+            RSWord* const codeword = codewords.data() + index * codewordLength;
+            
+            std::copy_n(data.data() + offset, length, codeword);
+            m_Codec->CalculateParity(codeword, length, codeword + length);
+        }
+    });
+    
+    co_return codewords;
+}
+
+AsyncTask<DecodeResult> AsyncCodec::Decode(std::vector<RSWord> codewords, const uint64_t messageLength) const
+{
+    const uint64_t nsym = m_Codec->m_NumOfErrorCorrectingSymbols;
+    
+    if(codewords.empty())
+        throw std::invalid_argument("Cannot decode empty data.");
+    
+    if(messageLength < 1)
+        throw std::invalid_argument("Message length cannot be zero.");
+    
+    const uint64_t codewordLength = messageLength + nsym;
+    const uint64_t numOfCodewords = GetNumberOfCodewords(codewords.size(), codewordLength, nsym);
+    const uint64_t codewordsPerStep = GetCodewordsPerStep(codewordLength);
+    
+    DecodeResult result;
+    result.message.resize(codewords.size() - numOfCodewords * nsym);
+    std::atomic<uint64_t> numOfErrorsFound = 0;
+    
+    co_await ParallelSteps(this, (numOfCodewords + codewordsPerStep - 1) / codewordsPerStep, [&](const uint64_t step)
+    {
+        const uint64_t end = std::min(numOfCodewords, (step + 1) * codewordsPerStep);
+        
+        for(uint64_t index = step * codewordsPerStep; index < end; index++)
+        {
+            const uint64_t offset = index * codewordLength;
+            const std::span<RSWord> codeword(codewords.data() + offset, std::min(codewordLength, codewords.size() - offset));
+            
+            numOfErrorsFound += m_Codec->DecodeInPlace(codeword);
+            std::copy_n(codeword.begin(), codeword.size() - nsym, result.message.begin() + static_cast<coef_diff_type>(index * messageLength));
+        }
+    });
+    
+    result.numOfErrorsFound = numOfErrorsFound;
+    co_return result;
+}
+
+AsyncGenerator<std::vector<RSWord>> AsyncCodec::DecodeChunks(std::vector<RSWord> codewords, const uint64_t messageLength) const
+{
+    const uint64_t nsym = m_Codec->m_NumOfErrorCorrectingSymbols;
+    
+    if(codewords.empty())
+        co_return;
+    
+    if(messageLength < 1)
+        throw std::invalid_argument("Message length cannot be zero.");
+    
+    const uint64_t codewordLength = messageLength + nsym;
+    const uint64_t numOfCodewords = GetNumberOfCodewords(codewords.size(), codewordLength, nsym);
+    const uint64_t codewordsPerStep = GetCodewordsPerStep(codewordLength);
+    
+    // One step at a time, so the consumer sees the first chunk as early as possible
+    for(uint64_t first = 0; first < numOfCodewords; first += codewordsPerStep)
+    {
+        const uint64_t end = std::min(numOfCodewords, first + codewordsPerStep);
+        std::vector<RSWord> chunk;
+        
+        co_await ParallelSteps(this, 1, [&](uint64_t)
+        {
+            for(uint64_t index = first; index < end; index++)
+            {
+                const uint64_t offset = index * codewordLength;
+                const std::span<RSWord> codeword(codewords.data() + offset, std::min(codewordLength, codewords.size() - offset));
+                
+                m_Codec->DecodeInPlace(codeword);
+                chunk.insert(chunk.end(), codeword.begin(), codeword.end() - static_cast<coef_diff_type>(nsym));
+            }
+        });
+        
+        co_yield std::move(chunk);
+    }
+}
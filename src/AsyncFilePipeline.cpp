@@ -0,0 +1,545 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  AsyncFilePipeline.cpp                                           */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#include "ReedSolomon.hpp"
+
+#if RS_IO_URING
+#include <sys/eventfd.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#endif
+
+using namespace NReedSolomon;
+
+namespace
+{
+uint64_t RoundUpToAlignment(const uint64_t value)
+{
+    return (value + AsyncFilePipeline::Alignment - 1) / AsyncFilePipeline::Alignment * AsyncFilePipeline::Alignment;
+}
+
+// Fallback without io_uring
+ContainerHeader ProtectWithStreams(const std::filesystem::path& input, const std::filesystem::path& output, const ReedSolomon& reedSolomon, const uint64_t chunkSize, const ContainerLayout layout, const bool chunkChecksums)
+{
+    std::ifstream file(input, std::ios::binary);
+    
+    if(!file)
+        throw std::runtime_error("Unable to open input file.");
+    
+    ContainerWriter writer(output, reedSolomon, chunkSize, layout, 0, chunkChecksums);
+    std::vector<RSWord> buffer(chunkSize);
+    
+    while(file.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(buffer.size())) || file.gcount() > 0)
+        writer.Write(std::span<const RSWord>(buffer.data(), static_cast<uint64_t>(file.gcount())));
+    
+    writer.Finish();
+    
+    return writer.GetHeader();
+}
+
+ContainerScrubReport VerifyWithStreams(const std::filesystem::path& container, const bool repair)
+{
+    ContainerReader reader(container, 1, repair ? ContainerAccess::ReadWrite : ContainerAccess::ReadOnly);
+    return reader.Scrub(repair);
+}
+
+#if RS_IO_URING
+// Largest transfer of a single read or write on Linux (MAX_RW_COUNT), larger requests return short
+constexpr uint64_t MaxIoLength = 0x7FFFF000;
+
+class FileDescriptor
+{
+    int m_Fd = -1;
+    
+public:
+    FileDescriptor(const std::filesystem::path& path, const int flags, const char* const error)
+        : m_Fd(open(path.c_str(), flags | O_CLOEXEC, 0644))
+    {
+        if(m_Fd < 0)
+            throw std::runtime_error(std::string(error) + ": " + std::strerror(errno));
+    }
+    
+    explicit FileDescriptor(const int fd) : m_Fd(fd)
+    {
+        if(m_Fd < 0)
+            throw std::runtime_error(std::string("Unable to create descriptor: ") + std::strerror(errno));
+    }
+    
+    FileDescriptor(const FileDescriptor&) = delete;
+    FileDescriptor& operator=(const FileDescriptor&) = delete;
+    
+    ~FileDescriptor()
+    {
+        close(m_Fd);
+    }
+    
+    [[nodiscard]] int Get() const noexcept { return m_Fd; }
+};
+
+void WriteFully(const int fd, const uint8_t* data, uint64_t length, uint64_t offset)
+{
+    while(length > 0)
+    {
+        const ssize_t written = pwrite(fd, data, length, static_cast<off_t>(offset));
+        
+        if(written < 0 && errno == EINTR)
+            continue;
+        
+        if(written <= 0)
+            throw std::runtime_error(std::string("Unable to write container file: ") + std::strerror(errno));
+        
+        data += written;
+        length -= static_cast<uint64_t>(written);
+        offset += static_cast<uint64_t>(written);
+    }
+}
+#endif
+}
+
+AsyncFilePipeline::AsyncFilePipeline(const AsyncFilePipelineSettings& settings)
+    : m_Settings(settings)
+    , m_ThreadPool(settings.numOfThreads)
+{
+    if(settings.queueDepth < 1)
+        throw std::invalid_argument("Queue depth must be at least one.");
+}
+
+#if RS_IO_URING
+
+// Event loop of the I/O thread. Workers report finished chunks through an eventfd, which has a read
+// in flight on the ring, so waiting for a completion also wakes up for finished computations.
+//
+// Compute tasks reference this frame and the kernel transfers into the slot buffers, so Run only returns
+// or throws once no task is running and every request has completed.
+void AsyncFilePipeline::Run(const uint64_t numOfChunks, std::vector<Slot>& slots, const Stages& stages)
+{
+    constexpr uint64_t eventUserData = ~0ULL;
+    
+    const FileDescriptor eventFd(eventfd(0, EFD_CLOEXEC));
+    uint64_t eventCounter = 0;
+    bool isEventReadPending = false;
+    
+    IoUring ring(static_cast<uint32_t>(slots.size() + 1));
+    
+    // Finished tasks are pushed, the eventfd written and the condition notified under the mutex,
+    // so a task is done with this frame once its slot index is visible
+    std::mutex finishedMutex;
+    std::condition_variable finishedCondition;
+    std::vector<uint64_t> finishedSlots;
+    
+    std::vector<uint64_t> freeSlots(slots.size());
+    for(uint64_t i = 0; i < slots.size(); i++)
+        freeSlots[i] = slots.size() - 1 - i;
+    
+    uint64_t nextChunk = 0;
+    uint64_t numOfCompletedChunks = 0;
+    uint64_t numOfPendingRequests = 0;
+    uint64_t numOfComputing = 0; // Submitted tasks whose slot index was not taken from finishedSlots yet
+    std::exception_ptr error;
+    
+    try
+    {
+        ring.PrepareRead(eventFd.Get(), &eventCounter, sizeof(eventCounter), 0, eventUserData);
+        isEventReadPending = true;
+        
+        while(true)
+        {
+            // Fill the queue, stop issuing new chunks after an error but finish everything in flight
+            while(!error && !freeSlots.empty() && nextChunk < numOfChunks)
+            {
+                const uint64_t index = freeSlots.back();
+                freeSlots.pop_back();
+                
+                slots[index].chunkIndex = nextChunk++;
+                slots[index].isWriting = false;
+                stages.read(ring, slots[index], index);
+                numOfPendingRequests++;
+            }
+            
+            if(numOfPendingRequests == 0 && numOfComputing == 0 && (error || numOfCompletedChunks == numOfChunks))
+                break;
+            
+            const IoUring::Completion completion = ring.WaitForCompletion();
+            
+            if(completion.userData == eventUserData)
+            {
+                isEventReadPending = false;
+                
+                if(completion.result < 0)
+                    throw std::runtime_error("Unable to read pipeline event."); // Nothing can be waited for anymore
+                
+                std::vector<uint64_t> finished;
+                {
+                    std::lock_guard<std::mutex> lock(finishedMutex);
+                    finished.swap(finishedSlots);
+                }
+                
+                numOfComputing -= finished.size();
+                
+                for(const uint64_t index : finished)
+                {
+                    Slot& slot = slots[index];
+                    
+                    if(slot.error && !error)
+                        error = slot.error;
+                    
+                    if(!slot.error && !error && slot.needsWrite)
+                    {
+                        slot.isWriting = true;
+                        stages.write(ring, slot, index);
+                        numOfPendingRequests++;
+                    }
+                    else
+                    {
+                        numOfCompletedChunks++;
+                        freeSlots.push_back(index);
+                    }
+                }
+                
+                ring.PrepareRead(eventFd.Get(), &eventCounter, sizeof(eventCounter), 0, eventUserData);
+                isEventReadPending = true;
+                continue;
+            }
+            
+            Slot& slot = slots[completion.userData];
+            numOfPendingRequests--;
+            
+            if(completion.result < 0 || static_cast<uint64_t>(completion.result) < slot.ioLength)
+            {
+                if(!error)
+                {
+                    const std::string reason = (completion.result < 0) ? std::strerror(-completion.result) : "unexpected end of file";
+                    error = std::make_exception_ptr(std::runtime_error(std::string(slot.isWriting ? "Write" : "Read") + " failed: " + reason));
+                }
+                
+                freeSlots.push_back(completion.userData);
+                continue;
+            }
+            
+            if(slot.isWriting)
+            {
+                numOfCompletedChunks++;
+                freeSlots.push_back(completion.userData);
+                continue;
+            }
+            
+            (void)m_ThreadPool.Submit([&stages, &slot, &finishedMutex, &finishedCondition, &finishedSlots, &eventFd, index = completion.userData]()
+            {
+                slot.error = nullptr;
+                
+                try
+                {
+                    slot.needsWrite = stages.compute(slot);
+                }
+                catch(...)
+                {
+                    slot.error = std::current_exception();
+                }
+                
+                std::lock_guard<std::mutex> lock(finishedMutex);
+                finishedSlots.push_back(index);
+                
+                const uint64_t one = 1;
+                (void)!write(eventFd.Get(), &one, sizeof(one));
+                finishedCondition.notify_one();
+            });
+            
+            // Counted once queued, a throwing Submit leaves no task behind
+            numOfComputing++;
+        }
+    }
+    catch(...)
+    {
+        if(!error)
+            error = std::current_exception();
+    }
+    
+    // After an error tasks may still be running and requests in flight. Waiting for the ring cannot be
+    // given up without the kernel writing into freed buffers, so a failing ring terminates here.
+    [&]() noexcept
+    {
+        {
+            std::unique_lock<std::mutex> lock(finishedMutex);
+            finishedCondition.wait(lock, [&]() { return finishedSlots.size() == numOfComputing; });
+        }
+        
+        // Complete the pending eventfd read before its buffer goes out of scope
+        const uint64_t one = 1;
+        (void)!write(eventFd.Get(), &one, sizeof(one));
+        
+        while(numOfPendingRequests > 0 || isEventReadPending)
+        {
+            if(ring.WaitForCompletion().userData == eventUserData)
+                isEventReadPending = false;
+            else
+                numOfPendingRequests--;
+        }
+    }();
+    
+    if(error)
+        std::rethrow_exception(error);
+}
+
+ContainerHeader AsyncFilePipeline::Protect(const std::filesystem::path& input, const std::filesystem::path& output, const ReedSolomon& reedSolomon, const uint64_t chunkSize, const ContainerLayout layout, const bool chunkChecksums)
+{
+    if(!IsSupported())
+        return ProtectWithStreams(input, output, reedSolomon, chunkSize, layout, chunkChecksums);
+    
+    ContainerHeader header = ContainerCodec::CreateHeader(reedSolomon, chunkSize, layout, 0, chunkChecksums);
+    
+    if(m_Settings.directIo && chunkSize % Alignment != 0)
+        throw std::invalid_argument("Direct I/O requires a chunk size that is a multiple of the alignment.");
+    
+    // Every chunk is transferred by one request
+    if(header.GetStoredChunkSize(chunkSize) > MaxIoLength)
+        return ProtectWithStreams(input, output, reedSolomon, chunkSize, layout, chunkChecksums);
+    
+    const FileDescriptor inputFd(input, O_RDONLY | (m_Settings.directIo ? O_DIRECT : 0), "Unable to open input file");
+    const FileDescriptor outputFd(output, O_WRONLY | O_CREAT | O_TRUNC, "Unable to create container file");
+    
+    struct stat status{};
+    if(fstat(inputFd.Get(), &status) != 0)
+        throw std::runtime_error(std::string("Unable to query input file: ") + std::strerror(errno));
+    
+    header.dataSize = static_cast<uint64_t>(status.st_size);
+    header.numOfChunks = (header.dataSize + chunkSize - 1) / chunkSize;
+    
+    const uint64_t storedChunkSize = header.GetStoredChunkSize(chunkSize);
+    
+    // Chunk offsets follow from the index, all chunks but the last one are full
+    std::vector<ContainerChunkEntry> chunkTable = ContainerCodec::CreateChunkTable(header);
+    
+    std::vector<Slot> slots(std::min(m_Settings.queueDepth, std::max<uint64_t>(header.numOfChunks, 1)));
+    
+    // Input and output buffer of every slot, storedChunkSize covers both
+    const BufferPool buffers(2 * slots.size(), storedChunkSize, m_Settings.pageMode, Alignment);
+    
+    for(uint64_t i = 0; i < slots.size(); i++)
+    {
+        slots[i].input = buffers.GetBuffer(2 * i);
+        slots[i].output = buffers.GetBuffer(2 * i + 1);
+    }
+    
+    Stages stages;
+    
+    stages.read = [&](IoUring& ring, Slot& slot, const uint64_t userData)
+    {
+        const ContainerChunkEntry& entry = chunkTable[slot.chunkIndex];
+        
+        // Direct reads transfer whole blocks, the end of the file returns less
+        slot.ioLength = entry.dataSize;
+        ring.PrepareRead(inputFd.Get(), slot.input, static_cast<uint32_t>(m_Settings.directIo ? RoundUpToAlignment(entry.dataSize) : entry.dataSize), slot.chunkIndex * chunkSize, userData);
+    };
+    
+    stages.compute = [&](Slot& slot)
+    {
+        ContainerChunkEntry& entry = chunkTable[slot.chunkIndex];
+        const uint64_t size = header.GetStoredChunkSize(entry.dataSize);
+        
+        ContainerCodec::EncodeChunk(header, reedSolomon, slot.input, entry.dataSize, slot.output);
+        
+        if(header.chunkChecksums)
+        {
+            entry.checksum = CRC32C::Calculate(slot.output, size);
+            entry.hasChecksum = true;
+        }
+        
+        return true;
+    };
+    
+    stages.write = [&](IoUring& ring, Slot& slot, const uint64_t userData)
+    {
+        const ContainerChunkEntry& entry = chunkTable[slot.chunkIndex];
+        
+        slot.ioLength = header.GetStoredChunkSize(entry.dataSize);
+        ring.PrepareWrite(outputFd.Get(), slot.output, static_cast<uint32_t>(slot.ioLength), entry.offset, userData);
+    };
+    
+    Run(header.numOfChunks, slots, stages);
+    
+    const std::vector<uint8_t> table = ContainerCodec::SerializeChunkTable(header, chunkTable);
+    const std::array<uint8_t, ContainerHeader::Size> serializedHeader = ContainerCodec::SerializeHeader(header);
+    
+    WriteFully(outputFd.Get(), table.data(), table.size(), header.GetTableOffset());
+    WriteFully(outputFd.Get(), serializedHeader.data(), serializedHeader.size(), 0);
+    
+    return header;
+}
+
+ContainerScrubReport AsyncFilePipeline::Verify(const std::filesystem::path& container, const bool repair)
+{
+    if(!IsSupported())
+        return VerifyWithStreams(container, repair);
+    
+    ContainerHeader header;
+    std::vector<ContainerChunkEntry> chunkTable;
+    std::vector<bool> isChunkEntryCorrupted;
+    bool isHeaderCorrupted = false;
+    
+    {
+        const ContainerReader reader(container, 1);
+        
+        header = reader.GetHeader();
+        chunkTable.resize(header.numOfChunks);
+        isChunkEntryCorrupted.resize(header.numOfChunks);
+        isHeaderCorrupted = reader.IsHeaderCorrupted();
+        
+        for(uint64_t i = 0; i < header.numOfChunks; i++)
+        {
+            chunkTable[i] = reader.GetChunkEntry(i);
+            isChunkEntryCorrupted[i] = reader.IsChunkEntryCorrupted(i);
+        }
+    }
+    
+    // Every chunk is transferred by one request, including the alignment around it
+    if(header.GetStoredChunkSize(header.chunkSize) + 2 * Alignment > MaxIoLength)
+        return VerifyWithStreams(container, repair);
+    
+    const ReedSolomon reedSolomon(header.bitsPerWord, header.numOfErrorCorrectingSymbols);
+    
+    const FileDescriptor readFd(container, O_RDONLY | (m_Settings.directIo ? O_DIRECT : 0), "Unable to open container file");
+    const FileDescriptor writeFd(container, repair ? O_WRONLY : O_RDONLY, "Unable to open container file");
+    
+    const uint64_t storedChunkSize = header.GetStoredChunkSize(header.chunkSize);
+    
+    std::vector<Slot> slots(std::min(m_Settings.queueDepth, std::max<uint64_t>(header.numOfChunks, 1)));
+    
+    const BufferPool buffers(slots.size(), storedChunkSize + 2 * Alignment, m_Settings.pageMode, Alignment);
+    
+    for(uint64_t i = 0; i < slots.size(); i++)
+        slots[i].input = buffers.GetBuffer(i);
+    
+    std::vector<ContainerChunkState> states(header.numOfChunks, ContainerChunkState::Clean);
+    std::vector<uint32_t> checksums(header.numOfChunks);
+    
+    for(uint64_t i = 0; i < header.numOfChunks; i++)
+        checksums[i] = chunkTable[i].checksum;
+    
+    Stages stages;
+    
+    stages.read = [&](IoUring& ring, Slot& slot, const uint64_t userData)
+    {
+        const ContainerChunkEntry& entry = chunkTable[slot.chunkIndex];
+        const uint64_t size = header.GetStoredChunkSize(entry.dataSize);
+        
+        // Aligned superset of the chunk, needed for O_DIRECT
+        const uint64_t start = entry.offset / Alignment * Alignment;
+        
+        slot.bufferOffset = entry.offset - start;
+        slot.ioLength = slot.bufferOffset + size;
+        ring.PrepareRead(readFd.Get(), slot.input, static_cast<uint32_t>(RoundUpToAlignment(slot.ioLength)), start, userData);
+    };
+    
+    stages.compute = [&](Slot& slot)
+    {
+        const ContainerChunkEntry& entry = chunkTable[slot.chunkIndex];
+        RSWord* const storedChunk = slot.input + slot.bufferOffset;
+        const uint64_t size = header.GetStoredChunkSize(entry.dataSize);
+        
+        if(entry.hasChecksum && CRC32C::Calculate(storedChunk, size) == entry.checksum)
+            return false;
+        
+        ContainerChunkState& state = states[slot.chunkIndex];
+        state = ContainerCodec::RepairChunk(header, reedSolomon, storedChunk, entry.dataSize);
+        
+        if(header.chunkChecksums && state != ContainerChunkState::Uncorrectable)
+            checksums[slot.chunkIndex] = CRC32C::Calculate(storedChunk, size);
+        
+        return repair && state == ContainerChunkState::Corrupted;
+    };
+    
+    stages.write = [&](IoUring& ring, Slot& slot, const uint64_t userData)
+    {
+        const ContainerChunkEntry& entry = chunkTable[slot.chunkIndex];
+        
+        slot.ioLength = header.GetStoredChunkSize(entry.dataSize);
+        ring.PrepareWrite(writeFd.Get(), slot.input + slot.bufferOffset, static_cast<uint32_t>(slot.ioLength), entry.offset, userData);
+    };
+    
+    Run(header.numOfChunks, slots, stages);
+    
+    ContainerScrubReport report;
+    report.metadataCorrupted = isHeaderCorrupted || std::ranges::find(isChunkEntryCorrupted, true) != isChunkEntryCorrupted.end();
+    
+    for(uint64_t i = 0; i < header.numOfChunks; i++)
+    {
+        if(states[i] == ContainerChunkState::Corrupted)
+            report.corruptedChunks.push_back(i);
+        else if(states[i] == ContainerChunkState::Uncorrectable)
+            report.uncorrectableChunks.push_back(i);
+        
+        report.chunksVerified++;
+        report.bytesVerified += header.GetStoredChunkSize(chunkTable[i].dataSize);
+        
+        // Repaired chunk or damaged table entry, uncorrectable chunks keep their entry
+        const bool checksumChanged = checksums[i] != chunkTable[i].checksum || !chunkTable[i].hasChecksum;
+        
+        if(repair && header.chunkChecksums && states[i] != ContainerChunkState::Uncorrectable && (checksumChanged || isChunkEntryCorrupted[i]))
+        {
+            chunkTable[i].checksum = checksums[i];
+            
+            const std::array<uint8_t, ContainerChunkEntry::Size> serializedEntry = ContainerCodec::SerializeChunkEntry(chunkTable[i]);
+            WriteFully(writeFd.Get(), serializedEntry.data(), serializedEntry.size(), header.GetChunkEntryOffset(i));
+        }
+    }
+    
+    if(repair && isHeaderCorrupted)
+    {
+        const std::array<uint8_t, ContainerHeader::Size> serializedHeader = ContainerCodec::SerializeHeader(header);
+        WriteFully(writeFd.Get(), serializedHeader.data(), serializedHeader.size(), 0);
+    }
+    
+    return report;
+}
+
+#else
+
+void AsyncFilePipeline::Run(const uint64_t, std::vector<Slot>&, const Stages&)
+{
+    throw std::logic_error("io_uring is not available on this platform.");
+}
+
+ContainerHeader AsyncFilePipeline::Protect(const std::filesystem::path& input, const std::filesystem::path& output, const ReedSolomon& reedSolomon, const uint64_t chunkSize, const ContainerLayout layout, const bool chunkChecksums)
+{
+    return ProtectWithStreams(input, output, reedSolomon, chunkSize, layout, chunkChecksums);
+}
+
+ContainerScrubReport AsyncFilePipeline::Verify(const std::filesystem::path& container, const bool repair)
+{
+    return VerifyWithStreams(container, repair);
+}
+
+#endif
@@ -0,0 +1,233 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  BitslicedEncoder.cpp                                            */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#include "ReedSolomon.hpp"
+
+using namespace NReedSolomon;
+
+namespace
+{
+// Transposes an 8x8 bit matrix: bit j of byte i becomes bit i of byte j (Hacker's Delight)
+uint64_t Transpose8x8(uint64_t x)
+{
+    uint64_t t = (x ^ (x >> 7)) & 0x00AA00AA00AA00AAULL;
+    x = x ^ t ^ (t << 7);
+    
+    t = (x ^ (x >> 14)) & 0x0000CCCC0000CCCCULL;
+    x = x ^ t ^ (t << 14);
+    
+    t = (x ^ (x >> 28)) & 0x00000000F0F0F0F0ULL;
+    x = x ^ t ^ (t << 28);
+    
+    return x;
+}
+}
+
+BitslicedEncoder::BitslicedEncoder(const ReedSolomon& reedSolomon)
+    : m_ReedSolomon(&reedSolomon)
+    , m_BitsPerWord(reedSolomon.m_BitsPerWord)
+    , m_NumOfErrorCorrectingSymbols(reedSolomon.m_NumOfErrorCorrectingSymbols)
+{
+    if(m_BitsPerWord > 8 * sizeof(RSWord))
+        throw std::invalid_argument("Bits per word exceed the size of RSWord.");
+    
+    CompileSchedule();
+}
+
+// Multiplication by a constant c is linear over GF(2): column k of its bit matrix is c * x^k
+void BitslicedEncoder::CompileSchedule()
+{
+    const std::pmr::vector<RSWord>& generator = *m_ReedSolomon->m_GeneratorPolynomial->GetCoefficients();
+    const GaloisField* const galoisField = m_ReedSolomon->m_GaloisField;
+    
+    m_ScheduleOffsets.resize(m_NumOfErrorCorrectingSymbols + 1);
+    
+    for(uint64_t j = 0; j < m_NumOfErrorCorrectingSymbols; j++)
+    {
+        m_ScheduleOffsets[j] = m_Schedule.size();
+        
+        for(uint64_t inputBit = 0; inputBit < m_BitsPerWord; inputBit++)
+        {
+            const RSWord column = galoisField->Multiply(generator[j + 1], static_cast<RSWord>(1U << inputBit));
+            
+            for(uint64_t outputBit = 0; outputBit < m_BitsPerWord; outputBit++)
+            {
+                if((column >> outputBit) & 1)
+                    m_Schedule.push_back({static_cast<uint8_t>(outputBit), static_cast<uint8_t>(inputBit)});
+            }
+        }
+    }
+    
+    m_ScheduleOffsets[m_NumOfErrorCorrectingSymbols] = m_Schedule.size();
+}
+
+std::vector<std::vector<RSWord>> BitslicedEncoder::Encode(const std::vector<std::vector<RSWord>>& messages) const
+{
+    constexpr uint64_t wideBatch = 8 * MessagesPerWord;
+    
+    std::vector<std::vector<RSWord>> result(messages.size());
+    std::vector<const std::vector<RSWord>*> batchMessages;
+    std::vector<RSWord*> batchParities;
+    
+    for(uint64_t first = 0; first < messages.size(); first += wideBatch)
+    {
+        const uint64_t count = std::min<uint64_t>(wideBatch, messages.size() - first);
+        uint64_t length = 0;
+        
+        batchMessages.clear();
+        batchParities.clear();
+        
+        for(uint64_t i = first; i < first + count; i++)
+        {
+            if(messages[i].empty())
+                throw std::invalid_argument("Cannot encode empty message.");
+            
+            // Codeword = message followed by its parity
+            result[i].resize(messages[i].size() + m_NumOfErrorCorrectingSymbols);
+            std::ranges::copy(messages[i], result[i].begin());
+            
+            batchMessages.push_back(&messages[i]);
+            batchParities.push_back(result[i].data() + messages[i].size());
+            length = std::max<uint64_t>(length, messages[i].size());
+        }
+        
+        if(count <= MessagesPerWord)
+            EncodeBatch<1>(batchMessages.data(), count, length, batchParities.data());
+        else
+            EncodeBatch<8>(batchMessages.data(), count, length, batchParities.data());
+    }
+    
+    return result;
+}
+
+template <uint64_t Words>
+void BitslicedEncoder::EncodeBatch(const std::vector<RSWord>* const* const messages, const uint64_t numOfMessages, const uint64_t length, RSWord* const* const parities) const
+{
+    using Plane = std::array<uint64_t, Words>;
+    constexpr uint64_t numOfPlanes = 8; // Transpose always works on full bytes
+    
+    const uint64_t nsym = m_NumOfErrorCorrectingSymbols;
+    
+    // Parity registers as bit planes, used as ring buffer so the LFSR shift is only an index increment
+    std::vector<std::array<Plane, numOfPlanes>> registers(nsym);
+    uint64_t head = 0;
+    
+    // Gathers byte p of 8 messages into one word and transposes it into 8 bit plane bytes
+    auto gather = [&](const uint64_t firstMessage, const uint64_t p) -> uint64_t
+    {
+        uint64_t x = 0;
+        for(uint64_t t = 0; t < 8 && firstMessage + t < numOfMessages; t++)
+        {
+            const std::vector<RSWord>& message = *messages[firstMessage + t];
+            const uint64_t padding = length - message.size();
+            
+            if(p >= padding)
+                x |= static_cast<uint64_t>(message[p - padding]) << (8 * t);
+        }
+        
+        return Transpose8x8(x);
+    };
+    
+    for(uint64_t p = 0; p < length; p++)
+    {
+        std::array<Plane, numOfPlanes> feedback{};
+        
+        for(uint64_t w = 0; w < Words; w++)
+        {
+            for(uint64_t g = 0; g < 8; g++)
+            {
+                const uint64_t firstMessage = w * MessagesPerWord + g * 8;
+                if(firstMessage >= numOfMessages)
+                    break;
+                
+                const uint64_t planes = gather(firstMessage, p);
+                for(uint64_t b = 0; b < numOfPlanes; b++)
+                    feedback[b][w] |= ((planes >> (8 * b)) & 0xFF) << (8 * g);
+            }
+        }
+        
+        // Feedback = message symbol + highest remainder symbol, then shift the register
+        std::array<Plane, numOfPlanes>& highest = registers[head];
+        for(uint64_t b = 0; b < numOfPlanes; b++)
+        {
+            for(uint64_t w = 0; w < Words; w++)
+            {
+                feedback[b][w] ^= highest[b][w];
+                highest[b][w] = 0;
+            }
+        }
+        
+        head = (head + 1 == nsym) ? 0 : head + 1;
+        
+        // register[j] ^= generator[j + 1] * feedback, as XOR schedule
+        for(uint64_t j = 0; j < nsym; j++)
+        {
+            const uint64_t index = (head + j < nsym) ? head + j : head + j - nsym;
+            std::array<Plane, numOfPlanes>& reg = registers[index];
+            
+            for(uint64_t term = m_ScheduleOffsets[j]; term < m_ScheduleOffsets[j + 1]; term++)
+            {
+                Plane& output = reg[m_Schedule[term].outputBit];
+                const Plane& input = feedback[m_Schedule[term].inputBit];
+                
+                for(uint64_t w = 0; w < Words; w++)
+                    output[w] ^= input[w];
+            }
+        }
+    }
+    
+    // Transpose the registers back into parity symbols
+    for(uint64_t j = 0; j < nsym; j++)
+    {
+        const uint64_t index = (head + j < nsym) ? head + j : head + j - nsym;
+        const std::array<Plane, numOfPlanes>& reg = registers[index];
+        
+        for(uint64_t w = 0; w < Words; w++)
+        {
+            for(uint64_t g = 0; g < 8; g++)
+            {
+                const uint64_t firstMessage = w * MessagesPerWord + g * 8;
+                if(firstMessage >= numOfMessages)
+                    break;
+                
+                uint64_t planes = 0;
+                for(uint64_t b = 0; b < numOfPlanes; b++)
+                    planes |= ((reg[b][w] >> (8 * g)) & 0xFF) << (8 * b);
+                
+                const uint64_t symbols = Transpose8x8(planes);
+                for(uint64_t t = 0; t < 8 && firstMessage + t < numOfMessages; t++)
+                    parities[firstMessage + t][j] = static_cast<RSWord>(symbols >> (8 * t));
+            }
+        }
+    }
+}
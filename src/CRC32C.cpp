@@ -0,0 +1,143 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  CRC32C.cpp                                                      */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#include "ReedSolomon.hpp"
+
+#if RS_CRC32C_KERNELS
+#include <nmmintrin.h>
+#endif
+
+using namespace NReedSolomon;
+
+namespace
+{
+constexpr uint32_t Polynomial = 0x82F63B78; // Reflected Castagnoli polynomial
+
+// Slicing-by-8 tables: table[k][b] is the CRC of byte b followed by k zero bytes
+using SlicingTables = std::array<std::array<uint32_t, 256>, 8>;
+
+SlicingTables CreateSlicingTables()
+{
+    SlicingTables tables{};
+    
+    for(uint32_t b = 0; b < 256; b++)
+    {
+        uint32_t crc = b;
+        for(uint64_t bit = 0; bit < 8; bit++)
+            crc = (crc >> 1) ^ ((crc & 1) ? Polynomial : 0);
+        
+        tables[0][b] = crc;
+    }
+    
+    for(uint64_t k = 1; k < 8; k++)
+    {
+        for(uint64_t b = 0; b < 256; b++)
+            tables[k][b] = (tables[k - 1][b] >> 8) ^ tables[0][tables[k - 1][b] & 0xFF];
+    }
+    
+    return tables;
+}
+
+uint32_t CalculateSoftware(const RSWord* data, uint64_t length, uint32_t crc)
+{
+    alignas(CacheLineSize) static const SlicingTables tables = CreateSlicingTables();
+    
+    for(; length >= 8; data += 8, length -= 8)
+    {
+        uint64_t word = 0;
+        for(uint64_t i = 0; i < 8; i++)
+            word |= static_cast<uint64_t>(data[i]) << (8 * i);
+        
+        word ^= crc;
+        
+        crc = tables[7][word & 0xFF] ^ tables[6][(word >> 8) & 0xFF] ^ tables[5][(word >> 16) & 0xFF] ^ tables[4][(word >> 24) & 0xFF]
+            ^ tables[3][(word >> 32) & 0xFF] ^ tables[2][(word >> 40) & 0xFF] ^ tables[1][(word >> 48) & 0xFF] ^ tables[0][word >> 56];
+    }
+    
+    for(; length > 0; data++, length--)
+        crc = (crc >> 8) ^ tables[0][(crc ^ *data) & 0xFF];
+    
+    return crc;
+}
+
+#if RS_CRC32C_KERNELS
+__attribute__((target("sse4.2"))) uint32_t CalculateHardware(const RSWord* data, uint64_t length, uint32_t crc)
+{
+    uint64_t crc64 = crc;
+    
+    for(; length >= 8; data += 8, length -= 8)
+    {
+        uint64_t word = 0;
+        std::memcpy(&word, data, sizeof(word));
+        crc64 = _mm_crc32_u64(crc64, word);
+    }
+    
+    crc = static_cast<uint32_t>(crc64);
+    
+    for(; length > 0; data++, length--)
+        crc = _mm_crc32_u8(crc, *data);
+    
+    return crc;
+}
+#endif
+}
+
+bool CRC32C::IsHardwareAccelerated()
+{
+#if RS_CRC32C_KERNELS
+    static const bool supported = []
+    {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("sse4.2") != 0;
+    }();
+    
+    return supported;
+#else
+    return false;
+#endif
+}
+
+uint32_t CRC32C::Calculate(const RSWord* const data, const uint64_t length, const uint32_t crc)
+{
+#if RS_CRC32C_KERNELS
+    if(IsHardwareAccelerated())
+        return ~CalculateHardware(data, length, ~crc);
+#endif
+    
+    return CalculatePortable(data, length, crc);
+}
+
+uint32_t CRC32C::CalculatePortable(const RSWord* const data, const uint64_t length, const uint32_t crc)
+{
+    return ~CalculateSoftware(data, length, ~crc);
+}
@@ -0,0 +1,183 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  CodecService.cpp                                                */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#include "ReedSolomon.hpp"
+
+using namespace NReedSolomon;
+
+WorkspacePool::WorkspacePool(const uint64_t numOfSlots, const uint64_t numOfErrorCorrectingSymbols, const uint64_t maxCodewordLength)
+    : m_NumOfSlots(numOfSlots)
+    , m_NumOfErrorCorrectingSymbols(numOfErrorCorrectingSymbols)
+    , m_MaxCodewordLength(maxCodewordLength)
+{
+    if(m_NumOfSlots < 1)
+        throw std::invalid_argument("Workspace pool needs at least one slot.");
+    
+    m_Slots = std::make_unique<Slot[]>(m_NumOfSlots);
+    
+    // Allocate everything up front, the hot path never touches the heap
+    for(uint64_t i = 0; i < m_NumOfSlots; i++)
+        InitializeWorkspace(m_Slots[i].m_Workspace);
+}
+
+void WorkspacePool::InitializeWorkspace(CodecWorkspace& workspace) const
+{
+    workspace.syndromes.resize(m_NumOfErrorCorrectingSymbols);
+    workspace.codeword.reserve(m_MaxCodewordLength);
+}
+
+WorkspacePool::Lease WorkspacePool::Acquire()
+{
+    const uint64_t start = std::hash<std::thread::id>{}(std::this_thread::get_id()) % m_NumOfSlots;
+    
+    for(uint64_t i = 0; i < m_NumOfSlots; i++)
+    {
+        Slot& slot = m_Slots[(start + i) % m_NumOfSlots];
+        
+        // Cheap relaxed check first, only try to claim slots that look free
+        if(!slot.m_InUse.load(std::memory_order_relaxed) && !slot.m_InUse.exchange(true, std::memory_order_acquire))
+            return Lease(&slot);
+    }
+    
+    // Pool exhausted (more concurrent callers than slots), fall back to a private workspace
+    auto overflow = std::make_unique<CodecWorkspace>();
+    InitializeWorkspace(*overflow);
+    
+    return Lease(std::move(overflow));
+}
+
+WorkspacePool::Lease::Lease(Lease&& other) noexcept
+    : m_Slot(std::exchange(other.m_Slot, nullptr))
+    , m_Overflow(std::move(other.m_Overflow))
+{
+}
+
+WorkspacePool::Lease::~Lease()
+{
+    if(m_Slot)
+        m_Slot->m_InUse.store(false, std::memory_order_release);
+}
+
+CodecService::CodecService(std::shared_ptr<const ReedSolomon> codec, const uint64_t numOfThreads)
+    : m_Codec(std::move(codec))
+    , m_WorkspacePool(2 * std::max<uint64_t>({numOfThreads, std::thread::hardware_concurrency(), 1}),
+                      m_Codec ? m_Codec->m_NumOfErrorCorrectingSymbols : 0,
+                      m_Codec ? m_Codec->m_GaloisField->GetCardinality() - 1 : 0)
+    , m_ThreadPool(numOfThreads)
+{
+    if(!m_Codec)
+        throw std::invalid_argument("Codec cannot be nullptr.");
+}
+
+std::vector<RSWord> CodecService::Encode(const std::vector<RSWord>& message) const
+{
+    // Only the result is allocated
+    std::vector<RSWord> codeword(message.size() + m_Codec->m_NumOfErrorCorrectingSymbols);
+    Encode(message, codeword);
+    
+    return codeword;
+}
+
+DecodeResult CodecService::Decode(const std::vector<RSWord>& data, const std::vector<uint64_t>* const erasurePositions) const
+{
+    if(data.size() <= m_Codec->m_NumOfErrorCorrectingSymbols)
+        throw std::invalid_argument("Data to be decoded must be longer than the number of error correction symbols.");
+    
+    // Only the result is allocated
+    DecodeResult result;
+    result.message.resize(data.size() - m_Codec->m_NumOfErrorCorrectingSymbols);
+    result.numOfErrorsFound = Decode(data, result.message, erasurePositions);
+    
+    return result;
+}
+
+void CodecService::Encode(const std::span<const RSWord> message, const std::span<RSWord> codeword) const
+{
+    if(message.empty())
+        throw std::invalid_argument("Cannot encode empty message.");
+    
+    if(codeword.size() != message.size() + m_Codec->m_NumOfErrorCorrectingSymbols)
+        throw std::invalid_argument("Codeword buffer must hold the message and its error correction symbols.");
+    
+    std::ranges::copy(message, codeword.begin());
+    m_Codec->CalculateParity(message.data(), message.size(), codeword.data() + message.size());
+}
+
+uint64_t CodecService::Decode(const std::span<const RSWord> data, const std::span<RSWord> message, const std::vector<uint64_t>* const erasurePositions) const
+{
+    const uint64_t nsym = m_Codec->m_NumOfErrorCorrectingSymbols;
+    
+    if(data.size() <= nsym)
+        throw std::invalid_argument("Data to be decoded must be longer than the number of error correction symbols.");
+    
+    if(data.size() > m_Codec->m_GaloisField->GetCardinality() - 1)
+        throw std::invalid_argument("Data to be decoded exceeds the maximum codeword length.");
+    
+    if(message.size() != data.size() - nsym)
+        throw std::invalid_argument("Message buffer must hold the data without its error correction symbols.");
+    
+    const WorkspacePool::Lease workspace = m_WorkspacePool.Acquire();
+    
+    // Fast path: a clean codeword is simply stripped of its parity, no polynomial is ever built
+    m_Codec->CalculateSyndromes(data.data(), data.size(), workspace->syndromes.data());
+    
+    if(std::ranges::all_of(workspace->syndromes, [](const RSWord s) { return s == 0; }))
+    {
+        std::copy_n(data.begin(), message.size(), message.begin());
+        return 0;
+    }
+    
+    // Slow path: correct a copy in the workspace, its capacity covers the longest codeword
+    workspace->codeword.assign(data.begin(), data.end());
+    const uint64_t numOfErrorsFound = m_Codec->DecodeInPlace(workspace->codeword, erasurePositions);
+    
+    std::copy_n(workspace->codeword.begin(), message.size(), message.begin());
+    
+    return numOfErrorsFound;
+}
+
+std::future<std::vector<RSWord>> CodecService::SubmitEncode(std::vector<RSWord> message)
+{
+    return m_ThreadPool.Submit([this, message = std::move(message)]()
+    {
+        return Encode(message);
+    });
+}
+
+std::future<DecodeResult> CodecService::SubmitDecode(std::vector<RSWord> data, std::vector<uint64_t> erasurePositions)
+{
+    return m_ThreadPool.Submit([this, data = std::move(data), erasurePositions = std::move(erasurePositions)]()
+    {
+        return Decode(data, erasurePositions.empty() ? nullptr : &erasurePositions);
+    });
+}
@@ -35,7 +35,44 @@ the following restrictions:
 
 using namespace NReedSolomon;
 
-GaloisField::GaloisField(const uint64_t exponent)
+namespace
+{
+// Multiplication in GF(2^8) with x^8 + x^4 + x^3 + x + 1, the field GF2P8MULB is hardwired to
+uint8_t MultiplyHardwareDomain(uint8_t x, uint8_t y)
+{
+    uint8_t result = 0;
+    
+    while(y)
+    {
+        if(y & 1)
+            result ^= x;
+        
+        x = static_cast<uint8_t>((x << 1) ^ ((x & 0x80) ? 0x1B : 0));
+        y >>= 1;
+    }
+    
+    return result;
+}
+
+// GF2P8AFFINEQB layout: byte (7 - i) of the matrix selects the input bits XORed into output bit i
+uint64_t CreateAffineMatrix(const std::array<uint8_t, 8>& columns)
+{
+    uint64_t matrix = 0;
+    
+    for(uint64_t i = 0; i < 8; i++)
+    {
+        uint64_t row = 0;
+        for(uint64_t k = 0; k < 8; k++)
+            row |= static_cast<uint64_t>((columns[k] >> i) & 1) << k;
+        
+        matrix |= row << (8 * (7 - i));
+    }
+    
+    return matrix;
+}
+}
+
+GaloisField::GaloisField(const uint64_t exponent, const bool allowHardwareAcceleration)
     : m_PrimitivePolynomial(285)
     , m_Exponent(exponent)
     , m_Cardinality(1 << exponent) // 2^exponent
@@ -46,6 +83,12 @@ GaloisField::GaloisField(const uint64_t exponent)
         throw std::invalid_argument("Exponent must be smaller than 32.");
     
     PrecomputeTables();
+    
+    if(allowHardwareAcceleration && m_Exponent == 8 && GFNI::IsSupported())
+    {
+        PrecomputeHardwareTables();
+        m_Backend = GaloisFieldBackend::GFNI;
+    }
 }
 
 void GaloisField::PrecomputeTables()
@@ -75,6 +118,74 @@ void GaloisField::PrecomputeTables()
         m_ExponentialTable[i] = m_ExponentialTable[i - (m_Cardinality - 1)];
 }
 
+void GaloisField::PrecomputeHardwareTables()
+{
+    // Multiply by constant matrices
+    m_AffineMatrices.resize(m_Cardinality);
+    for(uint64_t c = 0; c < m_Cardinality; c++)
+    {
+        std::array<uint8_t, 8> columns{};
+        for(uint64_t k = 0; k < 8; k++)
+            columns[k] = Multiply(static_cast<RSWord>(c), static_cast<RSWord>(1 << k));
+        
+        m_AffineMatrices[c] = CreateAffineMatrix(columns);
+    }
+    
+    // Find a root of our primitive polynomial in the hardware field, alpha maps onto it
+    uint8_t root = 0;
+    for(uint64_t candidate = 2; candidate < m_Cardinality && root == 0; candidate++)
+    {
+        uint8_t value = 0;
+        uint8_t power = 1;
+        
+        for(uint64_t k = 0; k <= 8; k++)
+        {
+            if((m_PrimitivePolynomial >> k) & 1)
+                value ^= power;
+            
+            power = MultiplyHardwareDomain(power, static_cast<uint8_t>(candidate));
+        }
+        
+        if(value == 0)
+            root = static_cast<uint8_t>(candidate);
+    }
+    
+    if(root == 0)
+        throw std::logic_error("No isomorphism into the hardware Galois field.");
+    
+    // Isomorphism: sum(a_k * alpha^k) -> sum(a_k * root^k)
+    std::array<uint8_t, 8> toColumns{};
+    uint8_t power = 1;
+    for(uint64_t k = 0; k < 8; k++)
+    {
+        toColumns[k] = power;
+        power = MultiplyHardwareDomain(power, root);
+    }
+    
+    m_ToHardwareDomainTable.resize(m_Cardinality);
+    std::vector<RSWord> fromHardwareDomainTable(m_Cardinality);
+    
+    for(uint64_t x = 0; x < m_Cardinality; x++)
+    {
+        uint8_t mapped = 0;
+        for(uint64_t k = 0; k < 8; k++)
+        {
+            if((x >> k) & 1)
+                mapped ^= toColumns[k];
+        }
+        
+        m_ToHardwareDomainTable[x] = mapped;
+        fromHardwareDomainTable[mapped] = static_cast<RSWord>(x);
+    }
+    
+    std::array<uint8_t, 8> fromColumns{};
+    for(uint64_t k = 0; k < 8; k++)
+        fromColumns[k] = fromHardwareDomainTable[1 << k];
+    
+    m_ToHardwareDomainMatrix = CreateAffineMatrix(toColumns);
+    m_FromHardwareDomainMatrix = CreateAffineMatrix(fromColumns);
+}
+
 // ReSharper disable once CppMemberFunctionMayBeStatic
 RSWord GaloisField::Add(const RSWord x, const RSWord y) const noexcept // NOLINT(*-convert-member-functions-to-static)
 {
@@ -123,3 +234,42 @@ RSWord GaloisField::Inverse(const RSWord x) const
     
     return m_ExponentialTable[index];
 }
+
+void GaloisField::MultiplyRegion(RSWord* const destination, const RSWord* const source, const RSWord factor, const uint64_t length) const
+{
+    if(m_Backend == GaloisFieldBackend::GFNI)
+    {
+        GFNI::MultiplyRegion(destination, source, m_AffineMatrices[factor], length, false);
+        return;
+    }
+    
+    if(factor == 0)
+    {
+        std::fill_n(destination, length, 0);
+        return;
+    }
+    
+    const uint64_t logFactor = m_LogarithmicTable[factor];
+    for(uint64_t i = 0; i < length; i++)
+        destination[i] = (source[i] == 0) ? 0 : m_ExponentialTable[m_LogarithmicTable[source[i]] + logFactor];
+}
+
+void GaloisField::MultiplyAccumulate(RSWord* const destination, const RSWord* const source, const RSWord factor, const uint64_t length) const
+{
+    // Skip log(0)
+    if(factor == 0)
+        return;
+    
+    if(m_Backend == GaloisFieldBackend::GFNI)
+    {
+        GFNI::MultiplyRegion(destination, source, m_AffineMatrices[factor], length, true);
+        return;
+    }
+    
+    const uint64_t logFactor = m_LogarithmicTable[factor];
+    for(uint64_t i = 0; i < length; i++)
+    {
+        if(source[i] != 0)
+            destination[i] ^= m_ExponentialTable[m_LogarithmicTable[source[i]] + logFactor];
+    }
+}
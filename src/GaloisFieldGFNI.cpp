@@ -0,0 +1,302 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  GaloisFieldGFNI.cpp                                             */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#include "ReedSolomon.hpp"
+
+#if RS_GFNI_KERNELS
+#include <immintrin.h>
+#endif
+
+using namespace NReedSolomon;
+
+#if RS_GFNI_KERNELS
+
+#define RS_GFNI_TARGET __attribute__((target("avx2,gfni")))
+
+namespace
+{
+constexpr uint64_t VectorSize = 32;
+constexpr uint64_t BlockSize = 256;
+constexpr uint64_t MaxVectors = InlinePolynomial::Capacity / VectorSize;
+
+uint64_t RoundUpToVectorSize(const uint64_t length)
+{
+    return (length + VectorSize - 1) / VectorSize * VectorSize;
+}
+
+// Applies the bit matrix to every byte, length must be a multiple of the vector size
+RS_GFNI_TARGET void TransformInPlace(RSWord* const data, const uint64_t length, const uint64_t matrix)
+{
+    const __m256i m = _mm256_set1_epi64x(static_cast<long long>(matrix));
+    
+    for(uint64_t i = 0; i < length; i += VectorSize)
+    {
+        __m256i* const p = reinterpret_cast<__m256i*>(data + i);
+        _mm256_storeu_si256(p, _mm256_gf2p8affine_epi64_epi8(_mm256_loadu_si256(p), m, 0));
+    }
+}
+
+RS_GFNI_TARGET void MultiplyRegionKernel(RSWord* const destination, const RSWord* const source, const uint64_t matrix, const uint64_t length, const bool accumulate)
+{
+    const __m256i m = _mm256_set1_epi64x(static_cast<long long>(matrix));
+    uint64_t i = 0;
+    
+    for(; i + VectorSize <= length; i += VectorSize)
+    {
+        __m256i product = _mm256_gf2p8affine_epi64_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + i)), m, 0);
+        
+        if(accumulate)
+            product = _mm256_xor_si256(product, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(destination + i)));
+        
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + i), product);
+    }
+    
+    // Tail through a zero padded vector
+    if(i < length)
+    {
+        alignas(VectorSize) RSWord tmp[VectorSize] = {};
+        const uint64_t rest = length - i;
+        
+        std::memcpy(tmp, source + i, rest);
+        TransformInPlace(tmp, VectorSize, matrix);
+        
+        for(uint64_t j = 0; j < rest; j++)
+            destination[i + j] = accumulate ? destination[i + j] ^ tmp[j] : tmp[j];
+    }
+}
+
+// Horner's scheme for up to 32 * NumVectors roots at once: syndromes = syndromes * roots + data[j].
+// Starts from the values in syndromes and leaves them in the hardware domain, so a message can be fed in pieces.
+template <uint64_t NumVectors>
+RS_GFNI_TARGET void SyndromesKernel(const GaloisField& galoisField, const RSWord* const data, const uint64_t length, const RSWord* const roots, RSWord* const syndromes)
+{
+    __m256i root[NumVectors];
+    __m256i syndrome[NumVectors];
+    
+    for(uint64_t v = 0; v < NumVectors; v++)
+    {
+        root[v] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(roots + v * VectorSize));
+        syndrome[v] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(syndromes + v * VectorSize));
+    }
+    
+    alignas(VectorSize) RSWord block[BlockSize];
+    
+    for(uint64_t position = 0; position < length; position += BlockSize)
+    {
+        const uint64_t n = std::min(BlockSize, length - position);
+        
+        std::memcpy(block, data + position, n);
+        std::fill(block + n, block + RoundUpToVectorSize(n), 0);
+        TransformInPlace(block, RoundUpToVectorSize(n), galoisField.GetToHardwareDomainMatrix());
+        
+        for(uint64_t j = 0; j < n; j++)
+        {
+            const __m256i symbol = _mm256_set1_epi8(static_cast<char>(block[j]));
+            
+            for(uint64_t v = 0; v < NumVectors; v++)
+                syndrome[v] = _mm256_xor_si256(_mm256_gf2p8mul_epi8(syndrome[v], root[v]), symbol);
+        }
+    }
+    
+    for(uint64_t v = 0; v < NumVectors; v++)
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(syndromes + v * VectorSize), syndrome[v]);
+}
+
+// Synthetic division: for every message symbol c, the nsym following symbols get c * generator added.
+// The remainder of one block is carried into the first nsym symbols of the next block, the first block
+// continues from the remainder in parity.
+template <uint64_t NumVectors>
+RS_GFNI_TARGET void ParityKernel(const GaloisField& galoisField, const RSWord* const generator, const uint64_t nsym, const RSWord* const message, const uint64_t length, RSWord* const parity)
+{
+    __m256i factor[NumVectors];
+    for(uint64_t v = 0; v < NumVectors; v++)
+        factor[v] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(generator + v * VectorSize));
+    
+    alignas(VectorSize) RSWord buffer[BlockSize + InlinePolynomial::Capacity + VectorSize];
+    alignas(VectorSize) RSWord carry[InlinePolynomial::Capacity] = {};
+    
+    std::memcpy(carry, parity, nsym);
+    TransformInPlace(carry, RoundUpToVectorSize(nsym), galoisField.GetToHardwareDomainMatrix());
+    
+    for(uint64_t position = 0; position < length; position += BlockSize)
+    {
+        const uint64_t n = std::min(BlockSize, length - position);
+        
+        std::memcpy(buffer, message + position, n);
+        std::fill(std::begin(buffer) + static_cast<coef_diff_type>(n), std::end(buffer), 0);
+        TransformInPlace(buffer, RoundUpToVectorSize(n), galoisField.GetToHardwareDomainMatrix());
+        
+        for(uint64_t k = 0; k < nsym; k++)
+            buffer[k] ^= carry[k];
+        
+        for(uint64_t i = 0; i < n; i++)
+        {
+            // Skip multiplication by zero
+            if(buffer[i] == 0)
+                continue;
+            
+            const __m256i coefficient = _mm256_set1_epi8(static_cast<char>(buffer[i]));
+            
+            for(uint64_t v = 0; v < NumVectors; v++)
+            {
+                __m256i* const p = reinterpret_cast<__m256i*>(buffer + i + 1 + v * VectorSize);
+                _mm256_storeu_si256(p, _mm256_xor_si256(_mm256_loadu_si256(p), _mm256_gf2p8mul_epi8(factor[v], coefficient)));
+            }
+        }
+        
+        std::memcpy(carry, buffer + n, nsym);
+    }
+    
+    TransformInPlace(carry, RoundUpToVectorSize(nsym), galoisField.GetFromHardwareDomainMatrix());
+    std::memcpy(parity, carry, nsym);
+}
+
+template <template <uint64_t> class Kernel, typename... Arguments>
+void Dispatch(const uint64_t numOfVectors, Arguments&&... arguments)
+{
+    switch(numOfVectors)
+    {
+        case 1: Kernel<1>::Run(std::forward<Arguments>(arguments)...); break;
+        case 2: Kernel<2>::Run(std::forward<Arguments>(arguments)...); break;
+        case 3: Kernel<3>::Run(std::forward<Arguments>(arguments)...); break;
+        case 4: Kernel<4>::Run(std::forward<Arguments>(arguments)...); break;
+        case 5: Kernel<5>::Run(std::forward<Arguments>(arguments)...); break;
+        case 6: Kernel<6>::Run(std::forward<Arguments>(arguments)...); break;
+        case 7: Kernel<7>::Run(std::forward<Arguments>(arguments)...); break;
+        case 8: Kernel<8>::Run(std::forward<Arguments>(arguments)...); break;
+        default: throw std::invalid_argument("Too many symbols for the GFNI kernels.");
+    }
+}
+
+template <uint64_t NumVectors>
+struct Syndromes
+{
+    static void Run(const GaloisField& galoisField, const RSWord* data, uint64_t length, const RSWord* roots, RSWord* syndromes) { SyndromesKernel<NumVectors>(galoisField, data, length, roots, syndromes); }
+};
+
+template <uint64_t NumVectors>
+struct Parity
+{
+    static void Run(const GaloisField& galoisField, const RSWord* generator, uint64_t nsym, const RSWord* message, uint64_t length, RSWord* parity) { ParityKernel<NumVectors>(galoisField, generator, nsym, message, length, parity); }
+};
+}
+
+bool GFNI::IsSupported()
+{
+    __builtin_cpu_init(); // GaloisField may be constructed during static initialization
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("gfni");
+}
+
+void GFNI::MultiplyRegion(RSWord* const destination, const RSWord* const source, const uint64_t matrix, const uint64_t length, const bool accumulate)
+{
+    MultiplyRegionKernel(destination, source, matrix, length, accumulate);
+}
+
+void GFNI::CalculateSyndromes(const GaloisField& galoisField, const RSWord* const data, const uint64_t length, const uint64_t numOfSyndromes, RSWord* const syndromes)
+{
+    // Roots alpha^i in the hardware domain, zero padded to full vectors
+    alignas(VectorSize) RSWord roots[MaxVectors * VectorSize] = {};
+    alignas(VectorSize) RSWord result[MaxVectors * VectorSize];
+    
+    const uint64_t numOfVectors = RoundUpToVectorSize(numOfSyndromes) / VectorSize;
+    
+    if(numOfVectors > MaxVectors)
+        throw std::invalid_argument("Too many syndromes for the GFNI kernels.");
+    
+    for(uint64_t i = 0; i < numOfSyndromes; i++)
+    {
+        roots[i] = galoisField.ToHardwareDomain(galoisField.GetExponentialTable()[i]);
+        result[i] = galoisField.ToHardwareDomain(syndromes[i]);
+    }
+    
+    std::fill(std::begin(result) + static_cast<coef_diff_type>(numOfSyndromes), std::end(result), 0);
+    
+    Dispatch<Syndromes>(numOfVectors, galoisField, data, length, roots, result);
+    TransformInPlace(result, numOfVectors * VectorSize, galoisField.GetFromHardwareDomainMatrix());
+    std::memcpy(syndromes, result, numOfSyndromes);
+}
+
+void GFNI::AccumulateSyndromes(const GaloisField& galoisField, const RSWord* const roots, const RSWord* const data, const uint64_t length, const uint64_t numOfSyndromes, RSWord* const syndromes)
+{
+    const uint64_t numOfVectors = RoundUpToVectorSize(numOfSyndromes) / VectorSize;
+    
+    if(numOfVectors > MaxVectors)
+        throw std::invalid_argument("Too many syndromes for the GFNI kernels.");
+    
+    Dispatch<Syndromes>(numOfVectors, galoisField, data, length, roots, syndromes);
+}
+
+void GFNI::CalculateParity(const GaloisField& galoisField, const RSWord* const generator, const uint64_t nsym, const RSWord* const message, const uint64_t length, RSWord* const parity)
+{
+    // Generator without its leading 1 in the hardware domain, zero padded to full vectors
+    alignas(VectorSize) RSWord factors[MaxVectors * VectorSize] = {};
+    
+    const uint64_t numOfVectors = RoundUpToVectorSize(nsym) / VectorSize;
+    
+    if(numOfVectors > MaxVectors)
+        throw std::invalid_argument("Too many symbols for the GFNI kernels.");
+    
+    for(uint64_t j = 0; j < nsym; j++)
+        factors[j] = galoisField.ToHardwareDomain(generator[j + 1]);
+    
+    Dispatch<Parity>(numOfVectors, galoisField, factors, nsym, message, length, parity);
+}
+
+#else
+
+bool GFNI::IsSupported()
+{
+    return false;
+}
+
+void GFNI::MultiplyRegion(RSWord* const, const RSWord* const, const uint64_t, const uint64_t, const bool)
+{
+    throw std::logic_error("GFNI kernels are not available on this platform.");
+}
+
+void GFNI::CalculateSyndromes(const GaloisField&, const RSWord* const, const uint64_t, const uint64_t, RSWord* const)
+{
+    throw std::logic_error("GFNI kernels are not available on this platform.");
+}
+
+void GFNI::AccumulateSyndromes(const GaloisField&, const RSWord* const, const RSWord* const, const uint64_t, const uint64_t, RSWord* const)
+{
+    throw std::logic_error("GFNI kernels are not available on this platform.");
+}
+
+void GFNI::CalculateParity(const GaloisField&, const RSWord* const, const uint64_t, const RSWord* const, const uint64_t, RSWord* const)
+{
+    throw std::logic_error("GFNI kernels are not available on this platform.");
+}
+
+#endif
@@ -0,0 +1,163 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  IncrementalEncoder.cpp                                          */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#include "ReedSolomon.hpp"
+
+using namespace NReedSolomon;
+
+IncrementalEncoder::IncrementalEncoder(const ReedSolomon& reedSolomon)
+    : m_ReedSolomon(&reedSolomon)
+    , m_GaloisField(reedSolomon.m_GaloisField)
+{
+    const uint64_t maxCodewordLength = m_GaloisField->GetCardinality() - 1;
+    
+    if(maxCodewordLength <= m_ReedSolomon->m_NumOfErrorCorrectingSymbols)
+        throw std::invalid_argument("Number of error correction symbols leaves no room for a message.");
+    
+    m_MaxMessageLength = maxCodewordLength - m_ReedSolomon->m_NumOfErrorCorrectingSymbols;
+    
+    PrecomputeParityBasis();
+}
+
+// Row r is the parity of a message whose only non-zero symbol is a 1 of degree r
+void IncrementalEncoder::PrecomputeParityBasis()
+{
+    const std::pmr::vector<RSWord>& generator = *m_ReedSolomon->m_GeneratorPolynomial->GetCoefficients();
+    const uint64_t nsym = m_ReedSolomon->m_NumOfErrorCorrectingSymbols;
+    
+    m_ParityBasis.resize(m_MaxMessageLength * nsym);
+    
+    // x^nsym mod generator (monic, binary field) is the generator without its leading coefficient
+    std::copy(generator.begin() + 1, generator.end(), m_ParityBasis.begin());
+    
+    // Next row: multiply by x and reduce, one LFSR step
+    for(uint64_t r = 1; r < m_MaxMessageLength; r++)
+    {
+        const RSWord* const previous = &m_ParityBasis[(r - 1) * nsym];
+        RSWord* const current = &m_ParityBasis[r * nsym];
+        const RSWord feedback = previous[0];
+        
+        for(uint64_t j = 0; j < nsym; j++)
+        {
+            const RSWord shifted = (j + 1 < nsym) ? previous[j + 1] : 0;
+            current[j] = shifted ^ m_GaloisField->Multiply(generator[j + 1], feedback);
+        }
+    }
+}
+
+void IncrementalEncoder::UpdateParity(RSWord* const parity, const uint64_t messageLength, const uint64_t position, const RSWord oldValue, const RSWord newValue) const
+{
+    if(messageLength > m_MaxMessageLength)
+        throw std::invalid_argument("Message is too long for the Galois field.");
+    if(position >= messageLength)
+        throw std::out_of_range("Position is outside of the message.");
+    
+    const RSWord delta = oldValue ^ newValue;
+    
+    // Skip log(0)
+    if(delta == 0)
+        return;
+    
+    const uint64_t nsym = m_ReedSolomon->m_NumOfErrorCorrectingSymbols;
+    const RSWord* const basis = &m_ParityBasis[(messageLength - position - 1) * nsym];
+    
+    for(uint64_t j = 0; j < nsym; j++)
+        parity[j] ^= m_GaloisField->Multiply(basis[j], delta);
+}
+
+void IncrementalEncoder::UpdateParity(RSWord* const parity, const uint64_t messageLength, const uint64_t position, const RSWord* const oldData, const RSWord* const newData, const uint64_t count) const
+{
+    if(position + count > messageLength)
+        throw std::out_of_range("Range is outside of the message.");
+    
+    for(uint64_t i = 0; i < count; i++)
+        UpdateParity(parity, messageLength, position + i, oldData[i], newData[i]);
+}
+
+void IncrementalEncoder::UpdateSyndromes(RSWord* const syndromes, const uint64_t codewordLength, const uint64_t position, const RSWord oldValue, const RSWord newValue) const
+{
+    if(position >= codewordLength)
+        throw std::out_of_range("Position is outside of the codeword.");
+    
+    const RSWord delta = oldValue ^ newValue;
+    
+    // Skip log(0)
+    if(delta == 0)
+        return;
+    
+    const AlignedVector<RSWord>& exponentialTable = m_GaloisField->GetExponentialTable();
+    const uint64_t order = m_GaloisField->GetCardinality() - 1;
+    const uint64_t degree = (codewordLength - position - 1) % order;
+    const uint64_t logDelta = m_GaloisField->GetLogarithmicTable()[delta];
+    
+    // syndromes[i] += delta * alpha^(i * degree)
+    uint64_t exponent = 0;
+    for(uint64_t i = 0; i < m_ReedSolomon->m_NumOfErrorCorrectingSymbols; i++)
+    {
+        syndromes[i] ^= exponentialTable[logDelta + exponent];
+        
+        exponent += degree;
+        if(exponent >= order)
+            exponent -= order;
+    }
+}
+
+void IncrementalEncoder::UpdateSyndromes(RSWord* const syndromes, const uint64_t codewordLength, const uint64_t position, const RSWord* const oldData, const RSWord* const newData, const uint64_t count) const
+{
+    if(position + count > codewordLength)
+        throw std::out_of_range("Range is outside of the codeword.");
+    
+    for(uint64_t i = 0; i < count; i++)
+        UpdateSyndromes(syndromes, codewordLength, position + i, oldData[i], newData[i]);
+}
+
+void IncrementalEncoder::ModifyCodeword(std::vector<RSWord>& codeword, const uint64_t position, const std::vector<RSWord>& newData) const
+{
+    const uint64_t nsym = m_ReedSolomon->m_NumOfErrorCorrectingSymbols;
+    
+    if(codeword.size() <= nsym)
+        throw std::invalid_argument("Codeword is too short to contain error correction symbols.");
+    
+    const uint64_t messageLength = codeword.size() - nsym;
+    
+    if(position + newData.size() > messageLength)
+        throw std::out_of_range("Range is outside of the message.");
+    
+    RSWord* const parity = codeword.data() + messageLength;
+    
+    for(uint64_t i = 0; i < newData.size(); i++)
+    {
+        UpdateParity(parity, messageLength, position + i, codeword[position + i], newData[i]);
+        codeword[position + i] = newData[i];
+    }
+}
@@ -0,0 +1,230 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  InlinePolynomial.cpp                                            */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#include "ReedSolomon.hpp"
+
+using namespace NReedSolomon;
+
+InlinePolynomial::InlinePolynomial(const GaloisField* const galoisField)
+    : m_GaloisField(galoisField)
+{
+    if(!galoisField)
+        throw std::invalid_argument("GaloisField cannot be nullptr.");
+}
+
+InlinePolynomial::InlinePolynomial(const std::initializer_list<RSWord> coefficients, const GaloisField* const galoisField)
+    : InlinePolynomial(std::data(coefficients), coefficients.size(), galoisField)
+{
+}
+
+InlinePolynomial::InlinePolynomial(const RSWord* const coefficients, const uint64_t numOfCoefficients, const GaloisField* const galoisField)
+    : m_GaloisField(galoisField)
+    , m_NumOfCoefficients(numOfCoefficients)
+{
+    if(!galoisField)
+        throw std::invalid_argument("GaloisField cannot be nullptr.");
+    
+    CheckCapacity(m_NumOfCoefficients);
+    
+    if(coefficients && m_NumOfCoefficients > 0)
+        std::memcpy(m_Coefficients.data(), coefficients, sizeof(RSWord) * m_NumOfCoefficients);
+    else
+        std::fill_n(m_Coefficients.begin(), m_NumOfCoefficients, 0);
+}
+
+void InlinePolynomial::CheckCapacity(const uint64_t numOfCoefficients) const
+{
+    if(numOfCoefficients > Capacity)
+        throw std::length_error("Polynomial exceeds inline capacity.");
+}
+
+// Coefficients are stored highest degree first, so both polynomials are aligned at their end
+void InlinePolynomial::Add(const InlinePolynomial& polynomial)
+{
+    if(polynomial.m_NumOfCoefficients > m_NumOfCoefficients)
+    {
+        const uint64_t shift = polynomial.m_NumOfCoefficients - m_NumOfCoefficients;
+        
+        std::memmove(m_Coefficients.data() + shift, m_Coefficients.data(), sizeof(RSWord) * m_NumOfCoefficients);
+        std::fill_n(m_Coefficients.begin(), shift, 0);
+        m_NumOfCoefficients = polynomial.m_NumOfCoefficients;
+    }
+    
+    const uint64_t offset = m_NumOfCoefficients - polynomial.m_NumOfCoefficients;
+    
+    for(uint64_t i = 0; i < polynomial.m_NumOfCoefficients; i++)
+        m_Coefficients[i + offset] ^= polynomial.m_Coefficients[i];
+}
+
+void InlinePolynomial::Scale(const RSWord scalar)
+{
+    for(uint64_t i = 0; i < m_NumOfCoefficients; i++)
+        m_Coefficients[i] = m_GaloisField->Multiply(m_Coefficients[i], scalar);
+}
+
+InlinePolynomial InlinePolynomial::operator* (const RSWord scalar) const
+{
+    InlinePolynomial result = *this;
+    result.Scale(scalar);
+    
+    return result;
+}
+
+// In place: result coefficient k only depends on own coefficients <= k, so compute from the highest degree down
+void InlinePolynomial::Multiply(const InlinePolynomial& polynomial)
+{
+    if(m_NumOfCoefficients == 0 || polynomial.m_NumOfCoefficients == 0)
+    {
+        m_NumOfCoefficients = 0;
+        return;
+    }
+    
+    const uint64_t numCoefficients = m_NumOfCoefficients + polynomial.m_NumOfCoefficients - 1;
+    CheckCapacity(numCoefficients);
+    
+    for(uint64_t k = numCoefficients; k-- > 0;)
+    {
+        const uint64_t first = (k >= polynomial.m_NumOfCoefficients) ? k - polynomial.m_NumOfCoefficients + 1 : 0;
+        const uint64_t last = std::min(k, m_NumOfCoefficients - 1);
+        
+        RSWord sum = 0;
+        for(uint64_t i = first; i <= last; i++)
+            sum ^= m_GaloisField->Multiply(m_Coefficients[i], polynomial.m_Coefficients[k - i]);
+        
+        m_Coefficients[k] = sum;
+    }
+    
+    m_NumOfCoefficients = numCoefficients;
+}
+
+void InlinePolynomial::MultiplyTruncated(const InlinePolynomial& polynomial, const uint64_t numOfCoefficients)
+{
+    if(m_NumOfCoefficients == 0 || polynomial.m_NumOfCoefficients == 0)
+    {
+        m_NumOfCoefficients = 0;
+        return;
+    }
+    
+    const uint64_t fullNumOfCoefficients = m_NumOfCoefficients + polynomial.m_NumOfCoefficients - 1;
+    const uint64_t numOfKept = std::min(numOfCoefficients, fullNumOfCoefficients);
+    const uint64_t skipped = fullNumOfCoefficients - numOfKept;
+    CheckCapacity(numOfKept);
+    
+    // Lower coefficients still read the operands, so the result is collected separately
+    std::array<RSWord, Capacity> result;
+    
+    for(uint64_t k = skipped; k < fullNumOfCoefficients; k++)
+    {
+        const uint64_t first = (k >= polynomial.m_NumOfCoefficients) ? k - polynomial.m_NumOfCoefficients + 1 : 0;
+        const uint64_t last = std::min(k, m_NumOfCoefficients - 1);
+        
+        RSWord sum = 0;
+        for(uint64_t i = first; i <= last; i++)
+            sum ^= m_GaloisField->Multiply(m_Coefficients[i], polynomial.m_Coefficients[k - i]);
+        
+        result[k - skipped] = sum;
+    }
+    
+    std::copy_n(result.begin(), numOfKept, m_Coefficients.begin());
+    m_NumOfCoefficients = numOfKept;
+}
+
+void InlinePolynomial::Reverse()
+{
+    std::reverse(m_Coefficients.begin(), m_Coefficients.begin() + static_cast<coef_diff_type>(m_NumOfCoefficients));
+}
+
+RSWord InlinePolynomial::Evaluate(const RSWord x) const
+{
+    RSWord result = m_Coefficients[0];
+    for(uint64_t i = 1; i < m_NumOfCoefficients; i++)
+        result = m_GaloisField->Multiply(result, x) ^ m_Coefficients[i];
+    
+    return result;
+}
+
+std::pmr::vector<uint64_t> InlinePolynomial::ChienSearch(const uint64_t max, std::pmr::memory_resource* const resource) const
+{
+    // A nonzero polynomial has at most as many roots as its degree
+    std::pmr::vector<uint64_t> result(resource);
+    result.reserve(m_NumOfCoefficients);
+    
+    InlinePolynomial tmp = *this;
+    
+    for(uint64_t i = 0; i < max; i++)
+    {
+        RSWord sum = 0;
+        for(uint64_t j = 0; j < m_NumOfCoefficients; j++)
+        {
+            sum ^= tmp[j];
+            
+            const uint64_t index = m_NumOfCoefficients - j - 1;
+            tmp[j] = m_GaloisField->Multiply(tmp[j], m_GaloisField->GetExponentialTable()[index]);
+        }
+        
+        if(sum == 0)
+            result.push_back(i);
+    }
+    
+    return result;
+}
+
+void InlinePolynomial::Enlarge(const uint64_t numElementsToAdd, const RSWord value)
+{
+    if(numElementsToAdd < 1)
+        throw std::invalid_argument("Enlargement must be greater than zero.");
+    
+    CheckCapacity(m_NumOfCoefficients + numElementsToAdd);
+    
+    std::fill_n(m_Coefficients.begin() + static_cast<coef_diff_type>(m_NumOfCoefficients), numElementsToAdd, value);
+    m_NumOfCoefficients += numElementsToAdd;
+}
+
+// Cut n elements from the end
+void InlinePolynomial::TrimEnd(const uint64_t numElementsToTrim)
+{
+    if(numElementsToTrim > m_NumOfCoefficients)
+        throw std::invalid_argument("Cannot trim more elements than the size of the polynomial.");
+    
+    m_NumOfCoefficients -= numElementsToTrim;
+}
+
+// Cut n elements from the beginning
+void InlinePolynomial::TrimBeginning(const uint64_t numElementsToTrim)
+{
+    if(numElementsToTrim > m_NumOfCoefficients)
+        throw std::invalid_argument("Cannot trim more elements than the size of the polynomial.");
+    
+    m_NumOfCoefficients -= numElementsToTrim;
+    std::memmove(m_Coefficients.data(), m_Coefficients.data() + numElementsToTrim, sizeof(RSWord) * m_NumOfCoefficients);
+}
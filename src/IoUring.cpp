@@ -0,0 +1,275 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  IoUring.cpp                                                     */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#include "ReedSolomon.hpp"
+
+#if RS_IO_URING
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#endif
+
+using namespace NReedSolomon;
+
+#if RS_IO_URING
+
+namespace
+{
+void* MapRing(const int ringFd, const uint64_t size, const uint64_t offset)
+{
+    void* const ring = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, static_cast<off_t>(offset));
+    
+    if(ring == MAP_FAILED)
+        throw std::runtime_error(std::string("Unable to map io_uring: ") + std::strerror(errno));
+    
+    return ring;
+}
+
+template <typename T>
+T* RingField(void* const ring, const uint32_t offset)
+{
+    return reinterpret_cast<T*>(static_cast<uint8_t*>(ring) + offset);
+}
+}
+
+bool IoUring::IsSupported()
+{
+    static const bool supported = []
+    {
+        try
+        {
+            IoUring ring(1);
+            return true;
+        }
+        catch(const std::runtime_error&)
+        {
+            return false;
+        }
+    }();
+    
+    return supported;
+}
+
+IoUring::IoUring(const uint32_t numOfEntries)
+{
+    io_uring_params parameters{};
+    
+    m_RingFd = static_cast<int>(syscall(__NR_io_uring_setup, numOfEntries, &parameters));
+    
+    if(m_RingFd < 0)
+        throw std::runtime_error(std::string("Unable to set up io_uring: ") + std::strerror(errno));
+    
+    try
+    {
+        m_NumOfEntries = parameters.sq_entries;
+        
+        m_SubmissionRingSize = parameters.sq_off.array + parameters.sq_entries * sizeof(uint32_t);
+        m_CompletionRingSize = parameters.cq_off.cqes + parameters.cq_entries * sizeof(io_uring_cqe);
+        m_SubmissionEntriesSize = parameters.sq_entries * sizeof(io_uring_sqe);
+        
+        m_SubmissionRing = MapRing(m_RingFd, m_SubmissionRingSize, IORING_OFF_SQ_RING);
+        m_CompletionRing = MapRing(m_RingFd, m_CompletionRingSize, IORING_OFF_CQ_RING);
+        m_SubmissionEntries = MapRing(m_RingFd, m_SubmissionEntriesSize, IORING_OFF_SQES);
+    }
+    catch(...)
+    {
+        Release();
+        throw;
+    }
+    
+    m_SubmissionHead = RingField<uint32_t>(m_SubmissionRing, parameters.sq_off.head);
+    m_SubmissionTail = RingField<uint32_t>(m_SubmissionRing, parameters.sq_off.tail);
+    m_SubmissionMask = RingField<uint32_t>(m_SubmissionRing, parameters.sq_off.ring_mask);
+    m_SubmissionArray = RingField<uint32_t>(m_SubmissionRing, parameters.sq_off.array);
+    
+    m_CompletionHead = RingField<uint32_t>(m_CompletionRing, parameters.cq_off.head);
+    m_CompletionTail = RingField<uint32_t>(m_CompletionRing, parameters.cq_off.tail);
+    m_CompletionMask = RingField<uint32_t>(m_CompletionRing, parameters.cq_off.ring_mask);
+    m_CompletionEntries = RingField<io_uring_cqe>(m_CompletionRing, parameters.cq_off.cqes);
+}
+
+IoUring::~IoUring()
+{
+    Release();
+}
+
+void IoUring::Release() noexcept
+{
+    if(m_SubmissionEntries)
+        munmap(m_SubmissionEntries, m_SubmissionEntriesSize);
+    
+    if(m_CompletionRing)
+        munmap(m_CompletionRing, m_CompletionRingSize);
+    
+    if(m_SubmissionRing)
+        munmap(m_SubmissionRing, m_SubmissionRingSize);
+    
+    if(m_RingFd >= 0)
+        close(m_RingFd);
+    
+    m_SubmissionEntries = m_CompletionRing = m_SubmissionRing = nullptr;
+    m_RingFd = -1;
+}
+
+void IoUring::Prepare(const uint8_t opcode, const int fd, const void* const buffer, const uint32_t length, const uint64_t offset, const uint64_t userData)
+{
+    const uint32_t tail = *m_SubmissionTail;
+    
+    // Kernel consumes entries on submission, so only unsubmitted entries can fill the queue
+    if(tail - __atomic_load_n(m_SubmissionHead, __ATOMIC_ACQUIRE) >= m_NumOfEntries)
+        throw std::runtime_error("io_uring submission queue is full.");
+    
+    const uint32_t index = tail & *m_SubmissionMask;
+    io_uring_sqe* const entry = static_cast<io_uring_sqe*>(m_SubmissionEntries) + index;
+    
+    std::memset(entry, 0, sizeof(io_uring_sqe));
+    entry->opcode = opcode;
+    entry->fd = fd;
+    entry->addr = reinterpret_cast<uint64_t>(buffer);
+    entry->len = length;
+    entry->off = offset;
+    entry->user_data = userData;
+    
+    m_SubmissionArray[index] = index;
+    __atomic_store_n(m_SubmissionTail, tail + 1, __ATOMIC_RELEASE);
+    
+    m_NumOfPrepared++;
+}
+
+void IoUring::PrepareRead(const int fd, void* const buffer, const uint32_t length, const uint64_t offset, const uint64_t userData)
+{
+    Prepare(IORING_OP_READ, fd, buffer, length, offset, userData);
+}
+
+void IoUring::PrepareWrite(const int fd, const void* const buffer, const uint32_t length, const uint64_t offset, const uint64_t userData)
+{
+    Prepare(IORING_OP_WRITE, fd, buffer, length, offset, userData);
+}
+
+void IoUring::Enter(const uint32_t numToSubmit, const uint32_t minComplete)
+{
+    const uint32_t flags = (minComplete > 0) ? IORING_ENTER_GETEVENTS : 0;
+    
+    while(true)
+    {
+        const long result = syscall(__NR_io_uring_enter, m_RingFd, numToSubmit, minComplete, flags, nullptr, 0);
+        
+        if(result >= 0)
+        {
+            m_NumOfPrepared -= std::min(m_NumOfPrepared, static_cast<uint32_t>(result));
+            return;
+        }
+        
+        if(errno != EINTR)
+            throw std::runtime_error(std::string("io_uring_enter failed: ") + std::strerror(errno));
+    }
+}
+
+void IoUring::Submit()
+{
+    if(m_NumOfPrepared > 0)
+        Enter(m_NumOfPrepared, 0);
+}
+
+IoUring::Completion IoUring::WaitForCompletion()
+{
+    while(true)
+    {
+        const uint32_t head = *m_CompletionHead;
+        
+        if(head != __atomic_load_n(m_CompletionTail, __ATOMIC_ACQUIRE))
+        {
+            const io_uring_cqe& entry = static_cast<const io_uring_cqe*>(m_CompletionEntries)[head & *m_CompletionMask];
+            const Completion completion{entry.user_data, entry.res};
+            
+            __atomic_store_n(m_CompletionHead, head + 1, __ATOMIC_RELEASE);
+            
+            return completion;
+        }
+        
+        Enter(m_NumOfPrepared, 1);
+    }
+}
+
+#else
+
+bool IoUring::IsSupported()
+{
+    return false;
+}
+
+IoUring::IoUring(const uint32_t)
+{
+    throw std::runtime_error("io_uring is not available on this platform.");
+}
+
+IoUring::~IoUring() = default;
+
+void IoUring::Release() noexcept
+{
+}
+
+void IoUring::Prepare(const uint8_t, const int, const void* const, const uint32_t, const uint64_t, const uint64_t)
+{
+    throw std::logic_error("io_uring is not available on this platform.");
+}
+
+void IoUring::PrepareRead(const int, void* const, const uint32_t, const uint64_t, const uint64_t)
+{
+    throw std::logic_error("io_uring is not available on this platform.");
+}
+
+void IoUring::PrepareWrite(const int, const void* const, const uint32_t, const uint64_t, const uint64_t)
+{
+    throw std::logic_error("io_uring is not available on this platform.");
+}
+
+void IoUring::Enter(const uint32_t, const uint32_t)
+{
+    throw std::logic_error("io_uring is not available on this platform.");
+}
+
+void IoUring::Submit()
+{
+    throw std::logic_error("io_uring is not available on this platform.");
+}
+
+IoUring::Completion IoUring::WaitForCompletion()
+{
+    throw std::logic_error("io_uring is not available on this platform.");
+}
+
+#endif
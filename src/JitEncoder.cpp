@@ -0,0 +1,303 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  JitEncoder.cpp                                                  */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#include "ReedSolomon.hpp"
+
+#if RS_JIT_KERNELS
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+using namespace NReedSolomon;
+
+#if RS_JIT_KERNELS
+
+namespace
+{
+enum Register : uint8_t
+{
+    RAX = 0, RDX = 2, RSI = 6, RDI = 7, R8 = 8, R9 = 9
+};
+
+// Just the handful of instruction forms the kernel needs: [prefix] [REX] opcode ModRM [disp32]
+class Assembler
+{
+    std::vector<uint8_t>    m_Code;
+    
+    void Prefix(const uint8_t prefix, const bool wide, const uint8_t reg, const uint8_t rm)
+    {
+        if(prefix != 0)
+            Byte(prefix);
+        
+        const uint8_t rex = static_cast<uint8_t>(0x40 | (wide ? 0x08 : 0) | ((reg & 8) ? 0x04 : 0) | ((rm & 8) ? 0x01 : 0));
+        if(rex != 0x40)
+            Byte(rex);
+    }
+    
+public:
+    void Byte(const uint8_t value) { m_Code.push_back(value); }
+    
+    void Dword(const uint32_t value)
+    {
+        for(uint64_t i = 0; i < 4; i++)
+            Byte(static_cast<uint8_t>(value >> (8 * i)));
+    }
+    
+    void Qword(const uint64_t value)
+    {
+        for(uint64_t i = 0; i < 8; i++)
+            Byte(static_cast<uint8_t>(value >> (8 * i)));
+    }
+    
+    // Register operands, reg may also be an opcode extension
+    void RegReg(const uint8_t prefix, const bool wide, const std::initializer_list<uint8_t> opcode, const uint8_t reg, const uint8_t rm)
+    {
+        Prefix(prefix, wide, reg, rm);
+        for(const uint8_t byte : opcode)
+            Byte(byte);
+        
+        Byte(static_cast<uint8_t>(0xC0 | ((reg & 7) << 3) | (rm & 7)));
+    }
+    
+    // Memory operand [base + disp32], base must not be RSP or R12
+    void RegMem(const uint8_t prefix, const bool wide, const std::initializer_list<uint8_t> opcode, const uint8_t reg, const uint8_t base, const uint32_t displacement)
+    {
+        Prefix(prefix, wide, reg, base);
+        for(const uint8_t byte : opcode)
+            Byte(byte);
+        
+        Byte(static_cast<uint8_t>(0x80 | ((reg & 7) << 3) | (base & 7)));
+        Dword(displacement);
+    }
+    
+    // Jcc rel32, returns the position of the displacement for Patch()
+    uint64_t Jump(const uint8_t condition, const uint64_t target = 0)
+    {
+        Byte(0x0F);
+        Byte(condition);
+        Dword(static_cast<uint32_t>(target - (m_Code.size() + 4)));
+        
+        return m_Code.size() - 4;
+    }
+    
+    void Patch(const uint64_t position)
+    {
+        const uint32_t displacement = static_cast<uint32_t>(m_Code.size() - (position + 4));
+        std::memcpy(m_Code.data() + position, &displacement, sizeof(displacement));
+    }
+    
+    [[nodiscard]] uint64_t GetPosition() const noexcept { return m_Code.size(); }
+    [[nodiscard]] const std::vector<uint8_t>& GetCode() const noexcept { return m_Code; }
+};
+
+constexpr uint8_t JumpIfZero = 0x84;
+constexpr uint8_t JumpIfBelow = 0x82;
+constexpr uint8_t TemporaryRegister = 15;
+}
+
+#endif
+
+JitEncoder::JitEncoder(const ReedSolomon& reedSolomon, const bool allowJit)
+    : m_ReedSolomon(&reedSolomon)
+    , m_NumOfErrorCorrectingSymbols(reedSolomon.m_NumOfErrorCorrectingSymbols)
+{
+    if(allowJit && m_NumOfErrorCorrectingSymbols <= MaxNumOfErrorCorrectingSymbols && reedSolomon.m_BitsPerWord <= 8 * sizeof(RSWord))
+    {
+        CreateProductTable();
+        Compile();
+        
+        if(!IsCompiled())
+            m_Products = {};
+    }
+}
+
+void JitEncoder::CreateProductTable()
+{
+    const std::pmr::vector<RSWord>& generator = *m_ReedSolomon->m_GeneratorPolynomial->GetCoefficients();
+    const GaloisField* const galoisField = m_ReedSolomon->m_GaloisField;
+    const uint64_t numOfVectors = (m_NumOfErrorCorrectingSymbols + 15) / 16;
+    const uint64_t numOfRows = 1ULL << m_ReedSolomon->m_BitsPerWord;
+    
+    // Power of two stride, so the row offset is a shift
+    m_RowStride = std::bit_ceil(numOfVectors);
+    m_Products.assign(256 * m_RowStride, Vector());
+    
+    for(uint64_t f = 1; f < numOfRows; f++)
+    {
+        for(uint64_t j = 0; j < m_NumOfErrorCorrectingSymbols; j++)
+            m_Products[f * m_RowStride + j / 16].bytes[j % 16] = galoisField->Multiply(generator[j + 1], static_cast<RSWord>(f));
+    }
+}
+
+#if RS_JIT_KERNELS
+
+// void Kernel(const RSWord* message (rdi), uint64_t length (rsi), RSWord* state (rdx))
+// State in xmm0..xmm(n-1), symbol 0 of the remainder in the lowest byte of xmm0. Only volatile registers are used.
+void JitEncoder::Compile()
+{
+    __builtin_cpu_init();
+    if(!__builtin_cpu_supports("ssse3"))
+        return;
+    
+    const uint8_t numOfVectors = static_cast<uint8_t>((m_NumOfErrorCorrectingSymbols + 15) / 16);
+    const uint8_t rowShift = static_cast<uint8_t>(4 + std::countr_zero(m_RowStride));
+    
+    Assembler a;
+    
+    // movdqu xmm_k, [rdx + 16k]
+    for(uint8_t k = 0; k < numOfVectors; k++)
+        a.RegMem(0xF3, false, {0x0F, 0x6F}, k, RDX, 16U * k);
+    
+    // test rsi, rsi / jz done
+    a.RegReg(0, true, {0x85}, RSI, RSI);
+    const uint64_t skipLoop = a.Jump(JumpIfZero);
+    
+    // mov r8, products / add rsi, rdi (end of message)
+    a.Byte(0x49);
+    a.Byte(0xB8);
+    a.Qword(reinterpret_cast<uint64_t>(m_Products.data()));
+    a.RegReg(0, true, {0x01}, RDI, RSI);
+    
+    const uint64_t loop = a.GetPosition();
+    
+    // feedback = message[i] ^ remainder[0]: movzx eax, byte [rdi] / movd r9d, xmm0 / xor eax, r9d / movzx eax, al
+    a.RegMem(0, false, {0x0F, 0xB6}, RAX, RDI, 0);
+    a.RegReg(0x66, false, {0x0F, 0x7E}, 0, R9);
+    a.RegReg(0, false, {0x31}, R9, RAX);
+    a.RegReg(0, false, {0x0F, 0xB6}, RAX, RAX);
+    
+    // rax = products + feedback * row size: shl eax, rowShift / add rax, r8
+    a.RegReg(0, false, {0xC1}, 4, RAX);
+    a.Byte(rowShift);
+    a.RegReg(0, true, {0x01}, R8, RAX);
+    
+    // Shift the remainder down by one symbol: xmm_k = xmm_(k+1):xmm_k >> 8 bits, the last register shifts in a zero
+    for(uint8_t k = 0; k + 1 < numOfVectors; k++)
+    {
+        a.RegReg(0x66, false, {0x0F, 0x6F}, TemporaryRegister, k + 1);
+        a.RegReg(0x66, false, {0x0F, 0x3A, 0x0F}, TemporaryRegister, k);
+        a.Byte(1);
+        a.RegReg(0x66, false, {0x0F, 0x6F}, k, TemporaryRegister);
+    }
+    
+    a.RegReg(0x66, false, {0x0F, 0x73}, 3, numOfVectors - 1);
+    a.Byte(1);
+    
+    // pxor xmm_k, [rax + 16k]
+    for(uint8_t k = 0; k < numOfVectors; k++)
+        a.RegMem(0x66, false, {0x0F, 0xEF}, k, RAX, 16U * k);
+    
+    // inc rdi / cmp rdi, rsi / jb loop
+    a.RegReg(0, true, {0xFF}, 0, RDI);
+    a.RegReg(0, true, {0x39}, RSI, RDI);
+    a.Jump(JumpIfBelow, loop);
+    
+    a.Patch(skipLoop);
+    
+    // movdqu [rdx + 16k], xmm_k / ret
+    for(uint8_t k = 0; k < numOfVectors; k++)
+        a.RegMem(0xF3, false, {0x0F, 0x7F}, k, RDX, 16U * k);
+    
+    a.Byte(0xC3);
+    
+    // Write, then switch the pages to read + execute
+    const std::vector<uint8_t>& code = a.GetCode();
+    const uint64_t pageSize = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    const uint64_t size = (code.size() + pageSize - 1) / pageSize * pageSize;
+    
+    void* const memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(memory == MAP_FAILED)
+        return;
+    
+    std::memcpy(memory, code.data(), code.size());
+    
+    if(mprotect(memory, size, PROT_READ | PROT_EXEC) != 0)
+    {
+        munmap(memory, size);
+        return;
+    }
+    
+    m_Code = memory;
+    m_CodeSize = size;
+    m_Kernel = reinterpret_cast<Kernel>(memory);
+}
+
+JitEncoder::~JitEncoder()
+{
+    if(m_Code != nullptr)
+        munmap(m_Code, m_CodeSize);
+}
+
+#else
+
+void JitEncoder::Compile()
+{
+}
+
+JitEncoder::~JitEncoder() = default;
+
+#endif
+
+std::vector<RSWord> JitEncoder::Encode(const std::vector<RSWord>& message) const
+{
+    if(message.empty())
+        throw std::invalid_argument("Cannot encode empty message.");
+    
+    std::vector<RSWord> result(message.size() + m_NumOfErrorCorrectingSymbols);
+    std::ranges::copy(message, result.begin());
+    
+    CalculateParity(message.data(), message.size(), result.data() + message.size());
+    
+    return result;
+}
+
+void JitEncoder::CalculateParity(const RSWord* const message, const uint64_t length, RSWord* const parity) const
+{
+    std::fill_n(parity, m_NumOfErrorCorrectingSymbols, 0);
+    AccumulateParity(message, length, parity);
+}
+
+void JitEncoder::AccumulateParity(const RSWord* const message, const uint64_t length, RSWord* const parity) const
+{
+    if(m_Kernel == nullptr)
+    {
+        m_ReedSolomon->AccumulateParity(message, length, parity);
+        return;
+    }
+    
+    alignas(16) RSWord state[MaxNumOfErrorCorrectingSymbols] = {};
+    
+    std::memcpy(state, parity, m_NumOfErrorCorrectingSymbols);
+    m_Kernel(message, length, state);
+    std::memcpy(parity, state, m_NumOfErrorCorrectingSymbols);
+}
@@ -0,0 +1,322 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  NumaEncoder.cpp                                                 */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#include "ReedSolomon.hpp"
+
+#if RS_NUMA
+#include <sched.h>
+#endif
+
+using namespace NReedSolomon;
+
+namespace
+{
+// "0-3,8-11" -> 0 1 2 3 8 9 10 11
+std::vector<uint64_t> ParseCpuList(const std::string& list)
+{
+    std::vector<uint64_t> cpus;
+    uint64_t position = 0;
+    
+    while(position < list.size())
+    {
+        const uint64_t end = std::min<uint64_t>(list.find(',', position), list.size());
+        const std::string range = list.substr(position, end - position);
+        const uint64_t dash = range.find('-');
+        
+        if(!range.empty() && std::isdigit(static_cast<unsigned char>(range[0])))
+        {
+            const uint64_t first = std::stoull(range.substr(0, dash));
+            const uint64_t last = (dash == std::string::npos) ? first : std::stoull(range.substr(dash + 1));
+            
+            for(uint64_t cpu = first; cpu <= last; cpu++)
+                cpus.push_back(cpu);
+        }
+        
+        position = end + 1;
+    }
+    
+    return cpus;
+}
+
+void PinToCpus(const std::vector<uint64_t>& cpus)
+{
+#if RS_NUMA
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    
+    for(const uint64_t cpu : cpus)
+    {
+        if(cpu < CPU_SETSIZE)
+            CPU_SET(cpu, &set);
+    }
+    
+    // On failure (e.g. CPUs outside the cgroup) the worker keeps its default affinity
+    sched_setaffinity(0, sizeof(set), &set);
+#else
+    (void)cpus;
+#endif
+}
+}
+
+NumaTopology::NumaTopology(std::vector<NumaNode> nodes)
+    : m_Nodes(std::move(nodes))
+{
+    if(m_Nodes.empty())
+        throw std::invalid_argument("NUMA topology needs at least one node.");
+    
+    if(std::ranges::any_of(m_Nodes, [](const NumaNode& node) { return node.cpus.empty(); }))
+        throw std::invalid_argument("Every NUMA node needs at least one CPU.");
+}
+
+NumaTopology NumaTopology::Detect()
+{
+    std::vector<NumaNode> nodes;
+
+#if RS_NUMA
+    std::error_code error;
+    
+    for(const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator("/sys/devices/system/node", error))
+    {
+        const std::string name = entry.path().filename().string();
+        
+        if(name.size() <= 4 || name.compare(0, 4, "node") != 0 || !std::all_of(name.begin() + 4, name.end(), [](const char c) { return std::isdigit(static_cast<unsigned char>(c)) != 0; }))
+            continue;
+        
+        std::ifstream file(entry.path() / "cpulist");
+        std::string list;
+        std::getline(file, list);
+        
+        // Memory only nodes have no CPUs to run workers on
+        NumaNode node{std::stoull(name.substr(4)), ParseCpuList(list)};
+        if(!node.cpus.empty())
+            nodes.push_back(std::move(node));
+    }
+    
+    std::ranges::sort(nodes, {}, &NumaNode::id);
+#endif
+    
+    if(nodes.empty())
+    {
+        NumaNode node;
+        for(uint64_t cpu = 0; cpu < std::max(1U, std::thread::hardware_concurrency()); cpu++)
+            node.cpus.push_back(cpu);
+        
+        nodes.push_back(std::move(node));
+    }
+    
+    return NumaTopology(std::move(nodes));
+}
+
+const NumaCodewordBuffer::Partition& NumaCodewordBuffer::FindPartition(const uint64_t index) const
+{
+    if(index >= m_NumOfCodewords)
+        throw std::out_of_range("Codeword index is outside of the buffer.");
+    
+    // Last partition starting at or before index
+    const auto partition = std::ranges::upper_bound(m_Partitions, index, {}, &Partition::firstCodeword);
+    return *std::prev(partition);
+}
+
+std::span<RSWord> NumaCodewordBuffer::GetCodeword(const uint64_t index)
+{
+    const Partition& partition = FindPartition(index);
+    const uint64_t length = (index + 1 == m_NumOfCodewords) ? m_CodewordLength - m_MessageLength + m_LastMessageLength : m_CodewordLength;
+    
+    return {partition.memory->GetData() + (index - partition.firstCodeword) * m_CodewordLength, length};
+}
+
+std::span<const RSWord> NumaCodewordBuffer::GetCodeword(const uint64_t index) const
+{
+    return const_cast<NumaCodewordBuffer*>(this)->GetCodeword(index); // NOLINT(*-pro-type-const-cast)
+}
+
+NumaEncoder::NumaEncoder(const uint64_t bitsPerWord, const uint64_t numOfErrorCorrectingSymbols, const NumaTopology& topology, const NumaEncoderSettings& settings)
+    : m_BitsPerWord(bitsPerWord)
+    , m_NumOfErrorCorrectingSymbols(numOfErrorCorrectingSymbols)
+    , m_Settings(settings)
+{
+    if(settings.batchSize < 1)
+        throw std::invalid_argument("Batch size cannot be smaller than one codeword.");
+    
+    // Pinning only pays off if there is more than one node
+    const bool pinWorkers = topology.GetNumberOfNodes() > 1;
+    
+    for(const NumaNode& numaNode : topology.GetNodes())
+    {
+        Node& node = m_Nodes.emplace_back();
+        node.node = numaNode;
+        
+        const uint64_t numOfThreads = settings.threadsPerNode > 0 ? settings.threadsPerNode : numaNode.cpus.size();
+        
+        node.threadPool = std::make_unique<ThreadPool>(numOfThreads, [pinWorkers, cpus = numaNode.cpus](uint64_t)
+        {
+            if(pinWorkers)
+                PinToCpus(cpus);
+        });
+        
+        // Allocated and filled by a worker of the node: the tables are first touched there
+        node.codec = node.threadPool->Submit([bitsPerWord, numOfErrorCorrectingSymbols]()
+        {
+            return std::make_unique<ReedSolomon>(bitsPerWord, numOfErrorCorrectingSymbols);
+        }).get();
+    }
+}
+
+uint64_t NumaEncoder::GetNumberOfThreads() const
+{
+    uint64_t numOfThreads = 0;
+    
+    for(const Node& node : m_Nodes)
+        numOfThreads += node.threadPool->GetNumberOfThreads();
+    
+    return numOfThreads;
+}
+
+void NumaEncoder::ForEachCodeword(const NumaCodewordBuffer& buffer, const std::function<void(const ReedSolomon&, uint64_t)>& function) const
+{
+    const uint64_t batchSize = m_Settings.batchSize;
+    
+    // Workers of a node claim batches of their partition only
+    std::vector<std::atomic<uint64_t>> next(buffer.m_Partitions.size());
+    std::vector<std::future<void>> results;
+    
+    for(uint64_t p = 0; p < buffer.m_Partitions.size(); p++)
+    {
+        const NumaCodewordBuffer::Partition& partition = buffer.m_Partitions[p];
+        const Node& node = m_Nodes[partition.node];
+        const uint64_t numOfBatches = (partition.numOfCodewords + batchSize - 1) / batchSize;
+        
+        for(uint64_t t = 0; t < std::min(node.threadPool->GetNumberOfThreads(), numOfBatches); t++)
+        {
+            results.push_back(node.threadPool->Submit([&partition, &node, &counter = next[p], batchSize, &function]()
+            {
+                for(uint64_t first = counter.fetch_add(batchSize); first < partition.numOfCodewords; first = counter.fetch_add(batchSize))
+                {
+                    for(uint64_t i = first; i < std::min(first + batchSize, partition.numOfCodewords); i++)
+                        function(*node.codec, partition.firstCodeword + i);
+                }
+            }));
+        }
+    }
+    
+    // Wait for every task before rethrowing, they reference this stack frame
+    std::exception_ptr error;
+    
+    for(std::future<void>& result : results)
+    {
+        try
+        {
+            result.get();
+        }
+        catch(...)
+        {
+            if(!error)
+                error = std::current_exception();
+        }
+    }
+    
+    if(error)
+        std::rethrow_exception(error);
+}
+
+NumaCodewordBuffer NumaEncoder::Encode(const std::span<const RSWord> data, const uint64_t messageLength) const
+{
+    if(data.empty())
+        throw std::invalid_argument("Cannot encode empty message.");
+    
+    if(messageLength < 1 || messageLength + m_NumOfErrorCorrectingSymbols > (1ULL << m_BitsPerWord) - 1)
+        throw std::invalid_argument("Message length exceeds the maximum codeword length.");
+    
+    NumaCodewordBuffer buffer;
+    buffer.m_MessageLength = messageLength;
+    buffer.m_CodewordLength = messageLength + m_NumOfErrorCorrectingSymbols;
+    buffer.m_NumOfCodewords = (data.size() + messageLength - 1) / messageLength;
+    buffer.m_LastMessageLength = data.size() - (buffer.m_NumOfCodewords - 1) * messageLength;
+    
+    // Codewords proportional to the workers of each node. The mappings are not touched here,
+    // the first write of the encoding workers allocates their pages on the home node.
+    const uint64_t numOfThreads = GetNumberOfThreads();
+    uint64_t firstCodeword = 0;
+    uint64_t threadsBefore = 0;
+    
+    for(uint64_t n = 0; n < m_Nodes.size(); n++)
+    {
+        threadsBefore += m_Nodes[n].threadPool->GetNumberOfThreads();
+        
+        const uint64_t end = buffer.m_NumOfCodewords * threadsBefore / numOfThreads;
+        if(end == firstCodeword)
+            continue;
+        
+        NumaCodewordBuffer::Partition& partition = buffer.m_Partitions.emplace_back();
+        partition.node = n;
+        partition.firstCodeword = firstCodeword;
+        partition.numOfCodewords = end - firstCodeword;
+        partition.memory = std::make_unique<BufferPool>(1, partition.numOfCodewords * buffer.m_CodewordLength, m_Settings.pageMode);
+        
+        firstCodeword = end;
+    }
+    
+    ForEachCodeword(buffer, [&buffer, data, messageLength](const ReedSolomon& codec, const uint64_t index)
+    {
+        const std::span<RSWord> codeword = buffer.GetCodeword(index);
+        const uint64_t length = codeword.size() - codec.m_NumOfErrorCorrectingSymbols;
+        
+        std::copy_n(data.begin() + static_cast<coef_diff_type>(index * messageLength), length, codeword.begin());
+        codec.CalculateParity(codeword.data(), length, codeword.data() + length);
+    });
+    
+    return buffer;
+}
+
+NumaDecodeReport NumaEncoder::Decode(NumaCodewordBuffer& buffer) const
+{
+    if(buffer.m_CodewordLength != buffer.m_MessageLength + m_NumOfErrorCorrectingSymbols)
+        throw std::invalid_argument("Buffer was encoded with a different number of error correcting symbols.");
+    
+    std::atomic<uint64_t> numOfErrorsCorrected = 0;
+    std::atomic<uint64_t> numOfFailedCodewords = 0;
+    
+    ForEachCodeword(buffer, [&](const ReedSolomon& codec, const uint64_t index)
+    {
+        try
+        {
+            numOfErrorsCorrected += codec.DecodeInPlace(buffer.GetCodeword(index));
+        }
+        catch(const std::runtime_error&)
+        {
+            numOfFailedCodewords++;
+        }
+    });
+    
+    return {numOfErrorsCorrected, numOfFailedCodewords};
+}
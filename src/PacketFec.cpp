@@ -0,0 +1,393 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  PacketFec.cpp                                                   */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#include "ReedSolomon.hpp"
+
+using namespace NReedSolomon;
+
+namespace
+{
+constexpr uint64_t LengthPrefixSize = 2;
+
+template <typename T>
+void Store(uint8_t*& buffer, const T value)
+{
+    for(uint64_t i = 0; i < sizeof(T); i++)
+        *buffer++ = static_cast<uint8_t>(static_cast<uint64_t>(value) >> (8 * i));
+}
+
+template <typename T>
+T Load(const uint8_t*& buffer)
+{
+    uint64_t value = 0;
+    for(uint64_t i = 0; i < sizeof(T); i++)
+        value |= static_cast<uint64_t>(*buffer++) << (8 * i);
+    
+    return static_cast<T>(value);
+}
+
+void ValidateSettings(const PacketFecSettings& settings)
+{
+    if(settings.numOfSourcePackets < 1 || settings.numOfRepairPackets < 1)
+        throw std::invalid_argument("Number of source and repair packets must be greater than zero.");
+    
+    if(settings.numOfSourcePackets + settings.numOfRepairPackets > 255)
+        throw std::invalid_argument("Source and repair packets of a window exceed the codeword length.");
+    
+    if(settings.repairInterval > settings.numOfSourcePackets)
+        throw std::invalid_argument("Repair interval must not exceed the window size.");
+}
+
+// Length prefix + payload
+std::vector<RSWord> CodeSourcePacket(const std::span<const RSWord> payload)
+{
+    std::vector<RSWord> coded(LengthPrefixSize + payload.size());
+    uint8_t* p = coded.data();
+    
+    Store<uint16_t>(p, static_cast<uint16_t>(payload.size()));
+    std::ranges::copy(payload, p);
+    
+    return coded;
+}
+}
+
+std::vector<RSWord> FecPacket::Serialize() const
+{
+    std::vector<RSWord> data(HeaderSize + payload.size());
+    uint8_t* p = data.data();
+    
+    Store<uint8_t>(p, isRepair ? 1 : 0);
+    Store<uint8_t>(p, static_cast<uint8_t>(repairIndex));
+    Store<uint8_t>(p, static_cast<uint8_t>(windowLength));
+    Store<uint8_t>(p, static_cast<uint8_t>(numOfRepairPackets));
+    Store<uint64_t>(p, sequence);
+    std::ranges::copy(payload, p);
+    
+    return data;
+}
+
+FecPacket FecPacket::Parse(const std::span<const RSWord> data)
+{
+    if(data.size() < HeaderSize)
+        throw std::runtime_error("FEC packet is too short.");
+    
+    const uint8_t* p = data.data();
+    FecPacket packet;
+    
+    const uint8_t type = Load<uint8_t>(p);
+    if(type > 1)
+        throw std::runtime_error("Unknown FEC packet type.");
+    
+    packet.isRepair = type == 1;
+    packet.repairIndex = Load<uint8_t>(p);
+    packet.windowLength = Load<uint8_t>(p);
+    packet.numOfRepairPackets = Load<uint8_t>(p);
+    packet.sequence = Load<uint64_t>(p);
+    packet.payload.assign(data.begin() + HeaderSize, data.end());
+    
+    return packet;
+}
+
+PacketFecEncoder::PacketFecEncoder(const PacketFecSettings& settings)
+    : m_Settings(settings)
+    , m_ReedSolomon(8, settings.numOfRepairPackets)
+{
+    ValidateSettings(m_Settings);
+    
+    // The code is linear: repair packet j is the sum of all source packets, each multiplied by the parity
+    // symbol j of a unit message with its 1 at that packet's position
+    const uint64_t k = m_Settings.numOfSourcePackets;
+    const uint64_t m = m_Settings.numOfRepairPackets;
+    const IncrementalEncoder basis(m_ReedSolomon);
+    
+    m_Coefficients.resize(k * m, 0);
+    
+    for(uint64_t r = 0; r < k; r++)
+        basis.UpdateParity(&m_Coefficients[r * m], r + 1, 0, 0, 1);
+}
+
+std::vector<FecPacket> PacketFecEncoder::Push(const std::span<const RSWord> payload)
+{
+    if(payload.size() > MaxPayloadSize)
+        throw std::invalid_argument("Payload exceeds the maximum packet size.");
+    
+    std::vector<FecPacket> packets;
+    
+    FecPacket& source = packets.emplace_back();
+    source.sequence = m_NextSequence++;
+    source.payload.assign(payload.begin(), payload.end());
+    
+    m_Window.push_back(CodeSourcePacket(payload));
+    if(m_Window.size() > m_Settings.numOfSourcePackets)
+        m_Window.pop_front();
+    
+    const uint64_t interval = m_Settings.repairInterval == 0 ? m_Settings.numOfSourcePackets : m_Settings.repairInterval;
+    
+    if(++m_SinceRepair == interval)
+    {
+        // Block mode: exactly the last K packets, sliding mode: up to K packets
+        AppendRepairPackets(m_Window.size(), packets);
+        m_SinceRepair = 0;
+    }
+    
+    return packets;
+}
+
+std::vector<FecPacket> PacketFecEncoder::Flush()
+{
+    std::vector<FecPacket> packets;
+    
+    if(m_SinceRepair > 0)
+    {
+        AppendRepairPackets(m_Settings.repairInterval == 0 ? m_SinceRepair : m_Window.size(), packets);
+        m_SinceRepair = 0;
+    }
+    
+    return packets;
+}
+
+void PacketFecEncoder::AppendRepairPackets(const uint64_t windowLength, std::vector<FecPacket>& packets) const
+{
+    const uint64_t m = m_Settings.numOfRepairPackets;
+    const uint64_t first = m_Window.size() - windowLength;
+    const GaloisField& galoisField = *m_ReedSolomon.m_GaloisField;
+    
+    uint64_t length = 0;
+    for(uint64_t i = first; i < m_Window.size(); i++)
+        length = std::max<uint64_t>(length, m_Window[i].size());
+    
+    const uint64_t firstRepair = packets.size();
+    
+    for(uint64_t j = 0; j < m; j++)
+    {
+        FecPacket& repair = packets.emplace_back();
+        repair.isRepair = true;
+        repair.sequence = m_NextSequence - windowLength;
+        repair.windowLength = windowLength;
+        repair.repairIndex = j;
+        repair.numOfRepairPackets = m;
+        repair.payload.assign(length, 0);
+    }
+    
+    // Region multiply-accumulate, the zero padding of shorter packets contributes nothing
+    for(uint64_t i = first; i < m_Window.size(); i++)
+    {
+        const std::vector<RSWord>& source = m_Window[i];
+        const RSWord* const row = &m_Coefficients[(m_Window.size() - 1 - i) * m];
+        
+        for(uint64_t j = 0; j < m; j++)
+            galoisField.MultiplyAccumulate(packets[firstRepair + j].payload.data(), source.data(), row[j], source.size());
+    }
+}
+
+PacketFecDecoder::PacketFecDecoder(const PacketFecSettings& settings)
+    : m_Settings(settings)
+    , m_ReedSolomon(8, settings.numOfRepairPackets)
+    , m_HistoryLength(2 * settings.numOfSourcePackets + settings.repairInterval)
+{
+    ValidateSettings(m_Settings);
+}
+
+std::vector<FecDeliveredPacket> PacketFecDecoder::Receive(const FecPacket& packet)
+{
+    std::vector<FecDeliveredPacket> delivered;
+    
+    if(!packet.isRepair)
+    {
+        if(packet.payload.size() > PacketFecEncoder::MaxPayloadSize)
+            throw std::runtime_error("FEC source packet exceeds the maximum packet size.");
+        
+        // Too old or already known
+        if(packet.sequence + m_HistoryLength < m_NewestSequence || m_SourcePackets.contains(packet.sequence))
+            return delivered;
+        
+        m_Statistics.sourcePacketsReceived++;
+        m_SourcePackets.emplace(packet.sequence, CodeSourcePacket(packet.payload));
+        m_NewestSequence = std::max(m_NewestSequence, packet.sequence);
+        delivered.push_back({packet.sequence, packet.payload, false});
+    }
+    else
+    {
+        if(packet.numOfRepairPackets != m_Settings.numOfRepairPackets || packet.repairIndex >= m_Settings.numOfRepairPackets
+           || packet.windowLength < 1 || packet.windowLength > m_Settings.numOfSourcePackets)
+            throw std::runtime_error("FEC repair packet does not match the settings.");
+        
+        const uint64_t last = packet.sequence + packet.windowLength - 1;
+        if(last + m_HistoryLength < m_NewestSequence)
+            return delivered;
+        
+        m_Statistics.repairPacketsReceived++;
+        m_Windows[{packet.sequence, packet.windowLength}].repairs.emplace(packet.repairIndex, packet.payload);
+        m_NewestSequence = std::max(m_NewestSequence, last);
+    }
+    
+    // A recovered packet may complete other (overlapping) windows
+    for(bool progress = true; progress;)
+    {
+        progress = false;
+        
+        for(auto it = m_Windows.begin(); it != m_Windows.end();)
+        {
+            const auto [first, length] = it->first;
+            uint64_t numOfLost = 0;
+            
+            for(uint64_t s = first; s < first + length; s++)
+                numOfLost += m_SourcePackets.contains(s) ? 0 : 1;
+            
+            if(numOfLost == 0)
+            {
+                it = m_Windows.erase(it);
+                continue;
+            }
+            
+            if(numOfLost <= it->second.repairs.size())
+            {
+                if(Recover(first, length, it->second, delivered))
+                    progress = true;
+                else
+                    m_Statistics.windowsFailed++;
+                
+                it = m_Windows.erase(it);
+                continue;
+            }
+            
+            ++it;
+        }
+    }
+    
+    Prune();
+    
+    return delivered;
+}
+
+// Every column is a codeword of the window's source packets followed by its repair packets
+bool PacketFecDecoder::Recover(const uint64_t first, const uint64_t length, const Window& window, std::vector<FecDeliveredPacket>& delivered)
+{
+    const uint64_t m = m_Settings.numOfRepairPackets;
+    
+    uint64_t columns = 0;
+    for(const auto& repair : window.repairs)
+        columns = std::max<uint64_t>(columns, repair.second.size());
+    
+    std::vector<uint64_t> erasurePositions;
+    for(uint64_t i = 0; i < length; i++)
+    {
+        if(!m_SourcePackets.contains(first + i))
+            erasurePositions.push_back(i);
+    }
+    
+    for(uint64_t j = 0; j < m; j++)
+    {
+        if(!window.repairs.contains(j))
+            erasurePositions.push_back(length + j);
+    }
+    
+    std::vector<const std::vector<RSWord>*> sources(length, nullptr);
+    for(uint64_t i = 0; i < length; i++)
+    {
+        const auto it = m_SourcePackets.find(first + i);
+        sources[i] = (it != m_SourcePackets.end()) ? &it->second : nullptr;
+    }
+    
+    std::vector<std::vector<RSWord>> recovered(length);
+    for(uint64_t i = 0; i < length; i++)
+    {
+        if(!sources[i])
+            recovered[i].resize(columns);
+    }
+    
+    std::vector<RSWord> codeword(length + m);
+    
+    for(uint64_t c = 0; c < columns; c++)
+    {
+        for(uint64_t i = 0; i < length; i++)
+            codeword[i] = (sources[i] && c < sources[i]->size()) ? (*sources[i])[c] : 0;
+        
+        for(uint64_t j = 0; j < m; j++)
+        {
+            const auto it = window.repairs.find(j);
+            codeword[length + j] = (it != window.repairs.end() && c < it->second.size()) ? it->second[c] : 0;
+        }
+        
+        if(!m_ReedSolomon.DecodeErasuresInPlace(codeword, erasurePositions))
+            return false;
+        
+        for(uint64_t i = 0; i < length; i++)
+        {
+            if(!sources[i])
+                recovered[i][c] = codeword[i];
+        }
+    }
+    
+    for(uint64_t i = 0; i < length; i++)
+    {
+        if(sources[i])
+            continue;
+        
+        const uint8_t* p = recovered[i].data();
+        const uint64_t payloadSize = columns >= LengthPrefixSize ? Load<uint16_t>(p) : columns;
+        
+        if(columns < LengthPrefixSize || payloadSize > columns - LengthPrefixSize)
+            return false;
+        
+        recovered[i].resize(LengthPrefixSize + payloadSize);
+        
+        FecDeliveredPacket& packet = delivered.emplace_back();
+        packet.sequence = first + i;
+        packet.payload.assign(recovered[i].begin() + LengthPrefixSize, recovered[i].end());
+        packet.recovered = true;
+        
+        m_SourcePackets.emplace(first + i, std::move(recovered[i]));
+        m_Statistics.packetsRecovered++;
+    }
+    
+    return true;
+}
+
+void PacketFecDecoder::Prune()
+{
+    if(m_NewestSequence < m_HistoryLength)
+        return;
+    
+    const uint64_t oldest = m_NewestSequence - m_HistoryLength;
+    
+    m_SourcePackets.erase(m_SourcePackets.begin(), m_SourcePackets.lower_bound(oldest));
+    
+    for(auto it = m_Windows.begin(); it != m_Windows.end();)
+    {
+        if(it->first.first + it->first.second <= oldest)
+            it = m_Windows.erase(it);
+        else
+            ++it;
+    }
+}
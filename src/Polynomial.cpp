@@ -35,25 +35,27 @@ the following restrictions:
 
 using namespace NReedSolomon;
 
-Polynomial::Polynomial(const GaloisField* const galoisField)
+Polynomial::Polynomial(const GaloisField* const galoisField, std::pmr::memory_resource* const resource)
     : m_GaloisField(galoisField)
+    , m_Coefficients(resource)
 {
     if(!galoisField)
         throw std::invalid_argument("GaloisField cannot be nullptr.");
 }
 
-Polynomial::Polynomial(const std::vector<RSWord>& coefficients, const GaloisField* const galoisField)
+Polynomial::Polynomial(const std::vector<RSWord>& coefficients, const GaloisField* const galoisField, std::pmr::memory_resource* const resource)
     : m_GaloisField(galoisField)
     , m_NumOfCoefficients(coefficients.size())
-    , m_Coefficients(coefficients)
+    , m_Coefficients(coefficients.begin(), coefficients.end(), resource)
 {
     if(!galoisField)
         throw std::invalid_argument("GaloisField cannot be nullptr.");
 }
 
-Polynomial::Polynomial(const RSWord* const coefficients, const uint64_t numOfCoefficients, const GaloisField* const galoisField)
+Polynomial::Polynomial(const RSWord* const coefficients, const uint64_t numOfCoefficients, const GaloisField* const galoisField, std::pmr::memory_resource* const resource)
     : m_GaloisField(galoisField)
     , m_NumOfCoefficients(numOfCoefficients)
+    , m_Coefficients(resource)
 {
     if(!galoisField)
         throw std::invalid_argument("GaloisField cannot be nullptr.");
@@ -71,7 +73,7 @@ void Polynomial::SetNew(const std::vector<RSWord>& coefficients, const GaloisFie
     if(galoisField)
         m_GaloisField = galoisField;
     
-    m_Coefficients = coefficients;
+    m_Coefficients.assign(coefficients.begin(), coefficients.end());
     m_NumOfCoefficients = m_Coefficients.size();
 }
 
@@ -102,7 +104,7 @@ void Polynomial::Clear()
 void Polynomial::Add(const Polynomial* const polynomial)
 {
     const uint64_t numCoefficients = std::max(m_NumOfCoefficients, polynomial->m_NumOfCoefficients);
-    std::vector<RSWord> coefficients(numCoefficients, 0);
+    std::pmr::vector<RSWord> coefficients(numCoefficients, 0, m_Coefficients.get_allocator());
     
     for(uint64_t i = 0; i < m_NumOfCoefficients; i++)
         coefficients[i + numCoefficients - m_NumOfCoefficients] = m_Coefficients[i];
@@ -111,7 +113,7 @@ void Polynomial::Add(const Polynomial* const polynomial)
         coefficients[i + numCoefficients - polynomial->m_NumOfCoefficients] ^= polynomial->m_Coefficients[i];
     
     m_NumOfCoefficients = numCoefficients;
-    m_Coefficients = coefficients;
+    m_Coefficients = std::move(coefficients);
 }
 
 void Polynomial::Scale(const RSWord scalar)
@@ -122,7 +124,7 @@ void Polynomial::Scale(const RSWord scalar)
 
 Polynomial Polynomial::operator* (const RSWord scalar) const
 {
-    Polynomial result = *this;
+    Polynomial result(m_Coefficients.data(), m_NumOfCoefficients, m_GaloisField, GetMemoryResource());
     
     for(uint64_t i = 0; i < m_NumOfCoefficients; i++)
         result[i] = m_GaloisField->Multiply(result[i], scalar);
@@ -133,7 +135,7 @@ Polynomial Polynomial::operator* (const RSWord scalar) const
 void Polynomial::Multiply(const Polynomial* const polynomial)
 {
     const uint64_t numCoefficients = m_NumOfCoefficients + polynomial->m_NumOfCoefficients - 1;
-    std::vector<RSWord> coefficients(numCoefficients, 0);
+    std::pmr::vector<RSWord> coefficients(numCoefficients, 0, m_Coefficients.get_allocator());
     
     for(uint64_t i = 0; i < m_NumOfCoefficients; i++)
     {
@@ -142,7 +144,7 @@ void Polynomial::Multiply(const Polynomial* const polynomial)
     }
     
     m_NumOfCoefficients = numCoefficients;
-    m_Coefficients = coefficients;
+    m_Coefficients = std::move(coefficients);
 }
 
 // Extended synthetic division
@@ -151,7 +153,7 @@ void Polynomial::Divide(const Polynomial* const divisor, Polynomial* const quoti
     if(divisor->m_NumOfCoefficients > m_NumOfCoefficients)
         throw std::runtime_error("Divisor has more coefficients than dividend.");
     
-    std::vector<RSWord> tmp = m_Coefficients;
+    std::pmr::vector<RSWord> tmp(m_Coefficients, m_Coefficients.get_allocator());
     const RSWord normalizer = divisor->m_Coefficients[0];
     const uint64_t upperLimit = m_NumOfCoefficients - divisor->m_NumOfCoefficients + 1;
     
@@ -171,9 +173,6 @@ void Polynomial::Divide(const Polynomial* const divisor, Polynomial* const quoti
         }
     }
     
-    // Save result
-    m_Coefficients = tmp;
-        
     // Extract quotient
     if(quotient_out)
         quotient_out->SetNew(tmp.data(), upperLimit);
@@ -181,6 +180,9 @@ void Polynomial::Divide(const Polynomial* const divisor, Polynomial* const quoti
     // Extract remainder
     if(remainder_out)
         remainder_out->SetNew(tmp.data() + upperLimit, divisor->m_NumOfCoefficients - 1);
+    
+    // Save result
+    m_Coefficients = std::move(tmp);
 }
 
 void Polynomial::Reverse()
@@ -197,10 +199,10 @@ RSWord Polynomial::Evaluate(const RSWord x) const
     return result;
 }
 
-std::vector<uint64_t> Polynomial::ChienSearch(const uint64_t max) const
+std::pmr::vector<uint64_t> Polynomial::ChienSearch(const uint64_t max) const
 {
-    std::vector<uint64_t> result;
-    Polynomial tmp = *this;
+    std::pmr::vector<uint64_t> result(GetMemoryResource());
+    Polynomial tmp(m_Coefficients.data(), m_NumOfCoefficients, m_GaloisField, GetMemoryResource());
     
     for(uint64_t i = 0; i < max; i++)
     {
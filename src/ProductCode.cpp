@@ -0,0 +1,248 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  ProductCode.cpp                                                 */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#include "ReedSolomon.hpp"
+
+using namespace NReedSolomon;
+
+namespace
+{
+std::vector<uint64_t> ToPositions(const std::vector<uint8_t>& flags)
+{
+    std::vector<uint64_t> positions;
+    
+    for(uint64_t i = 0; i < flags.size(); i++)
+    {
+        if(flags[i])
+            positions.push_back(i);
+    }
+    
+    return positions;
+}
+}
+
+ProductCode::ProductCode(const uint64_t numOfDataRows, const uint64_t numOfDataColumns, const uint64_t numOfRowParitySymbols, const uint64_t numOfColumnParitySymbols, const uint64_t numOfThreads)
+    : m_RowCodec(8, numOfRowParitySymbols)
+    , m_ColumnCodec(8, numOfColumnParitySymbols)
+    , m_NumOfDataRows(numOfDataRows)
+    , m_NumOfDataColumns(numOfDataColumns)
+    , m_ThreadPool(numOfThreads)
+{
+    if(numOfDataRows == 0 || numOfDataColumns == 0)
+        throw std::invalid_argument("Product code needs at least one data row and column.");
+    
+    if(GetNumberOfRows() > 255 || GetNumberOfColumns() > 255)
+        throw std::invalid_argument("Rows and columns of the product code must fit into a codeword.");
+}
+
+std::vector<RSWord> ProductCode::Encode(const std::span<const RSWord> data) const
+{
+    if(data.size() != m_NumOfDataRows * m_NumOfDataColumns)
+        throw std::invalid_argument("Data size does not match the product code.");
+    
+    const uint64_t width = GetNumberOfColumns();
+    std::vector<RSWord> block(GetBlockSize(), 0);
+    
+    m_ThreadPool.ParallelFor(m_NumOfDataRows, [&](const uint64_t row)
+    {
+        RSWord* const out = block.data() + row * width;
+        
+        std::copy_n(data.begin() + static_cast<coef_diff_type>(row * m_NumOfDataColumns), m_NumOfDataColumns, out);
+        m_RowCodec.CalculateParity(out, m_NumOfDataColumns, out + m_NumOfDataColumns);
+    });
+    
+    // Columns are linear combinations of rows, so the parity of the row parity is also a row codeword
+    m_ThreadPool.ParallelFor(width, [&](const uint64_t column)
+    {
+        std::array<RSWord, InlinePolynomial::Capacity> message;
+        std::array<RSWord, InlinePolynomial::Capacity> parity;
+        
+        for(uint64_t row = 0; row < m_NumOfDataRows; row++)
+            message[row] = block[row * width + column];
+        
+        m_ColumnCodec.CalculateParity(message.data(), m_NumOfDataRows, parity.data());
+        
+        for(uint64_t j = 0; j < m_ColumnCodec.m_NumOfErrorCorrectingSymbols; j++)
+            block[(m_NumOfDataRows + j) * width + column] = parity[j];
+    });
+    
+    return block;
+}
+
+bool ProductCode::DecodeRows(const std::span<RSWord> block, const std::vector<uint8_t>& failedColumns, std::vector<uint8_t>& failedRows, uint64_t& numOfCorrections) const
+{
+    const uint64_t width = GetNumberOfColumns();
+    const std::vector<uint64_t> erasures = ToPositions(failedColumns);
+    const bool useErasures = !erasures.empty() && erasures.size() <= m_RowCodec.m_NumOfErrorCorrectingSymbols;
+    
+    // Too many failed columns for erasures: they still locate the errors, a correction in a valid column is
+    // the miscorrection of a row beyond the capacity
+    const bool onlyFailedColumns = !erasures.empty() && !useErasures;
+    
+    std::vector<uint64_t> corrections(failedRows.size(), 0);
+    
+    m_ThreadPool.ParallelFor(failedRows.size(), [&](const uint64_t row)
+    {
+        const std::span<RSWord> codeword = block.subspan(row * width, width);
+        std::vector<Correction> rowCorrections;
+        
+        try
+        {
+            m_RowCodec.DecodeInPlace(codeword, useErasures ? &erasures : nullptr, &rowCorrections);
+        }
+        catch(const std::exception&)
+        {
+            failedRows[row] = 1;
+            return;
+        }
+        
+        if(onlyFailedColumns && std::ranges::any_of(rowCorrections, [&](const Correction& correction) { return failedColumns[correction.position] == 0; }))
+        {
+            for(const Correction& correction : rowCorrections)
+                codeword[correction.position] ^= correction.magnitude;
+            
+            failedRows[row] = 1;
+            return;
+        }
+        
+        failedRows[row] = 0;
+        corrections[row] = rowCorrections.size();
+    });
+    
+    for(const uint64_t count : corrections)
+        numOfCorrections += count;
+    
+    return std::ranges::none_of(failedRows, [](const uint8_t failed) { return failed != 0; });
+}
+
+bool ProductCode::DecodeColumns(const std::span<RSWord> block, const std::vector<uint8_t>& failedRows, std::vector<uint8_t>& failedColumns, uint64_t& numOfCorrections) const
+{
+    const uint64_t width = GetNumberOfColumns();
+    const uint64_t height = GetNumberOfRows();
+    const std::vector<uint64_t> erasures = ToPositions(failedRows);
+    const bool useErasures = !erasures.empty() && erasures.size() <= m_ColumnCodec.m_NumOfErrorCorrectingSymbols;
+    const bool onlyFailedRows = !erasures.empty() && !useErasures;
+    
+    std::vector<uint64_t> corrections(failedColumns.size(), 0);
+    
+    m_ThreadPool.ParallelFor(failedColumns.size(), [&](const uint64_t column)
+    {
+        std::array<RSWord, InlinePolynomial::Capacity> codeword;
+        std::vector<Correction> columnCorrections;
+        
+        for(uint64_t row = 0; row < height; row++)
+            codeword[row] = block[row * width + column];
+        
+        try
+        {
+            m_ColumnCodec.DecodeInPlace(std::span<RSWord>(codeword.data(), height), useErasures ? &erasures : nullptr, &columnCorrections);
+        }
+        catch(const std::exception&)
+        {
+            failedColumns[column] = 1;
+            return;
+        }
+        
+        // Same as for rows: corrections in valid rows are miscorrections
+        if(onlyFailedRows && std::ranges::any_of(columnCorrections, [&](const Correction& correction) { return failedRows[correction.position] == 0; }))
+        {
+            failedColumns[column] = 1;
+            return;
+        }
+        
+        failedColumns[column] = 0;
+        corrections[column] = columnCorrections.size();
+        
+        // Only the corrected symbols are written back
+        for(const Correction& correction : columnCorrections)
+            block[correction.position * width + column] ^= correction.magnitude;
+    });
+    
+    for(const uint64_t count : corrections)
+        numOfCorrections += count;
+    
+    return std::ranges::none_of(failedColumns, [](const uint8_t failed) { return failed != 0; });
+}
+
+ProductCodeReport ProductCode::Decode(const std::span<RSWord> block, const uint64_t maxIterations) const
+{
+    if(block.size() != GetBlockSize())
+        throw std::invalid_argument("Block size does not match the product code.");
+    
+    ProductCodeReport report;
+    std::vector<uint8_t> failedRows(GetNumberOfRows(), 0);
+    std::vector<uint8_t> failedColumns(GetNumberOfColumns(), 0);
+    
+    for(uint64_t iteration = 0; iteration < maxIterations; iteration++)
+    {
+        uint64_t rowCorrections = 0;
+        uint64_t columnCorrections = 0;
+        const std::vector<uint8_t> previousFailedRows = failedRows;
+        const std::vector<uint8_t> previousFailedColumns = failedColumns;
+        
+        const bool rowsValid = DecodeRows(block, failedColumns, failedRows, rowCorrections);
+        const bool columnsValid = DecodeColumns(block, failedRows, failedColumns, columnCorrections);
+        
+        report.numOfIterations++;
+        report.symbolsCorrected += rowCorrections + columnCorrections;
+        
+        // Every row was a codeword and the column pass changed nothing: all rows and columns are codewords
+        if(rowsValid && columnsValid && columnCorrections == 0)
+        {
+            report.success = true;
+            break;
+        }
+        
+        // Failed lines are the erasures of the next pass, an iteration that only changed them can still make progress
+        if(rowCorrections == 0 && columnCorrections == 0 && failedRows == previousFailedRows && failedColumns == previousFailedColumns)
+            break;
+    }
+    
+    report.numOfFailedRows = std::ranges::count(failedRows, 1);
+    report.numOfFailedColumns = std::ranges::count(failedColumns, 1);
+    
+    return report;
+}
+
+std::vector<RSWord> ProductCode::ExtractData(const std::span<const RSWord> block) const
+{
+    if(block.size() != GetBlockSize())
+        throw std::invalid_argument("Block size does not match the product code.");
+    
+    std::vector<RSWord> data(m_NumOfDataRows * m_NumOfDataColumns);
+    
+    for(uint64_t row = 0; row < m_NumOfDataRows; row++)
+        std::copy_n(block.begin() + static_cast<coef_diff_type>(row * GetNumberOfColumns()), m_NumOfDataColumns, data.begin() + static_cast<coef_diff_type>(row * m_NumOfDataColumns));
+    
+    return data;
+}
@@ -0,0 +1,702 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  ProtectedContainer.cpp                                          */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#include "ReedSolomon.hpp"
+
+using namespace NReedSolomon;
+
+namespace
+{
+template <typename T>
+void Store(uint8_t*& buffer, const T value)
+{
+    for(uint64_t i = 0; i < sizeof(T); i++)
+        *buffer++ = static_cast<uint8_t>(static_cast<uint64_t>(value) >> (8 * i));
+}
+
+template <typename T>
+T Load(const uint8_t*& buffer)
+{
+    uint64_t value = 0;
+    for(uint64_t i = 0; i < sizeof(T); i++)
+        value |= static_cast<uint64_t>(*buffer++) << (8 * i);
+    
+    return static_cast<T>(value);
+}
+
+// Metadata codecs are fixed, the header has to be corrected before the data codec is known
+const ReedSolomon& GetHeaderCodec()
+{
+    static const ReedSolomon codec(8, ContainerHeader::ParitySize);
+    return codec;
+}
+
+const ReedSolomon& GetChunkEntryCodec()
+{
+    static const ReedSolomon codec(8, ContainerChunkEntry::ParitySize);
+    return codec;
+}
+}
+
+uint64_t ContainerHeader::GetStoredChunkSize(const uint64_t chunkDataSize) const
+{
+    const uint64_t numOfCodewords = (chunkDataSize + messageLength - 1) / messageLength;
+    return chunkDataSize + numOfCodewords * numOfErrorCorrectingSymbols;
+}
+
+uint64_t ContainerHeader::GetChunkOffset(const uint64_t index) const
+{
+    return Size + index * GetStoredChunkSize(chunkSize);
+}
+
+uint64_t ContainerHeader::GetChunkDataSize(const uint64_t index) const
+{
+    return std::min(chunkSize, dataSize - index * chunkSize);
+}
+
+uint64_t ContainerHeader::GetTableOffset() const
+{
+    if(numOfChunks == 0)
+        return Size;
+    
+    return GetChunkOffset(numOfChunks - 1) + GetStoredChunkSize(GetChunkDataSize(numOfChunks - 1));
+}
+
+uint64_t ContainerHeader::GetTableSize() const
+{
+    return chunkChecksums ? numOfChunks * ContainerChunkEntry::Size : 0;
+}
+
+uint64_t ContainerHeader::GetChunkEntryOffset(const uint64_t index) const
+{
+    return GetTableOffset() + index * ContainerChunkEntry::Size;
+}
+
+ContainerHeader ContainerCodec::CreateHeader(const ReedSolomon& reedSolomon, const uint64_t chunkSize, const ContainerLayout layout, const uint64_t messageLength, const bool chunkChecksums)
+{
+    if(reedSolomon.m_BitsPerWord != 8 * sizeof(RSWord))
+        throw std::invalid_argument("Containers store full bytes, bits per word must match RSWord.");
+    
+    if(chunkSize < 1)
+        throw std::invalid_argument("Chunk size cannot be smaller than one byte.");
+    
+    const uint64_t maxMessageLength = reedSolomon.m_GaloisField->GetCardinality() - 1 - reedSolomon.m_NumOfErrorCorrectingSymbols;
+    
+    if(messageLength > maxMessageLength)
+        throw std::invalid_argument("Message length exceeds the maximum codeword length.");
+    
+    ContainerHeader header;
+    header.layout = layout;
+    header.bitsPerWord = reedSolomon.m_BitsPerWord;
+    header.numOfErrorCorrectingSymbols = reedSolomon.m_NumOfErrorCorrectingSymbols;
+    header.messageLength = (messageLength == 0) ? maxMessageLength : messageLength;
+    header.chunkSize = chunkSize;
+    header.chunkChecksums = chunkChecksums;
+    
+    return header;
+}
+
+std::vector<ContainerChunkEntry> ContainerCodec::CreateChunkTable(const ContainerHeader& header)
+{
+    std::vector<ContainerChunkEntry> chunkTable(header.numOfChunks);
+    
+    for(uint64_t i = 0; i < header.numOfChunks; i++)
+    {
+        chunkTable[i].offset = header.GetChunkOffset(i);
+        chunkTable[i].dataSize = header.GetChunkDataSize(i);
+    }
+    
+    return chunkTable;
+}
+
+std::array<uint8_t, ContainerHeader::Size> ContainerCodec::SerializeHeader(const ContainerHeader& header)
+{
+    std::array<uint8_t, ContainerHeader::Size> buffer{};
+    uint8_t* p = buffer.data();
+    
+    Store<uint32_t>(p, ContainerHeader::Magic);
+    Store<uint16_t>(p, ContainerHeader::FormatVersion);
+    Store<uint8_t>(p, static_cast<uint8_t>(header.layout));
+    Store<uint8_t>(p, header.bitsPerWord);
+    Store<uint32_t>(p, header.numOfErrorCorrectingSymbols);
+    Store<uint32_t>(p, header.messageLength);
+    Store<uint64_t>(p, header.chunkSize);
+    Store<uint64_t>(p, header.dataSize);
+    Store<uint64_t>(p, header.numOfChunks);
+    Store<uint8_t>(p, header.chunkChecksums ? 1 : 0);
+    
+    GetHeaderCodec().CalculateParity(buffer.data(), ContainerHeader::FieldsSize, buffer.data() + ContainerHeader::FieldsSize);
+    
+    return buffer;
+}
+
+std::array<uint8_t, ContainerChunkEntry::Size> ContainerCodec::SerializeChunkEntry(const ContainerChunkEntry& entry)
+{
+    std::array<uint8_t, ContainerChunkEntry::Size> buffer{};
+    uint8_t* p = buffer.data();
+    
+    Store<uint32_t>(p, entry.checksum);
+    GetChunkEntryCodec().CalculateParity(buffer.data(), ContainerChunkEntry::ChecksumSize, buffer.data() + ContainerChunkEntry::ChecksumSize);
+    
+    return buffer;
+}
+
+std::vector<uint8_t> ContainerCodec::SerializeChunkTable(const ContainerHeader& header, const std::vector<ContainerChunkEntry>& chunkTable)
+{
+    std::vector<uint8_t> buffer(header.GetTableSize());
+    
+    for(uint64_t i = 0; i < buffer.size() / ContainerChunkEntry::Size; i++)
+        std::ranges::copy(SerializeChunkEntry(chunkTable[i]), buffer.begin() + static_cast<std::ptrdiff_t>(i * ContainerChunkEntry::Size));
+    
+    return buffer;
+}
+
+uint64_t ContainerCodec::CorrectHeader(const std::span<uint8_t, ContainerHeader::Size> serializedHeader)
+{
+    return GetHeaderCodec().DecodeInPlace(serializedHeader);
+}
+
+uint64_t ContainerCodec::CorrectChunkEntry(const std::span<uint8_t, ContainerChunkEntry::Size> serializedEntry)
+{
+    return GetChunkEntryCodec().DecodeInPlace(serializedEntry);
+}
+
+void ContainerCodec::EncodeChunk(const ContainerHeader& header, const ReedSolomon& reedSolomon, const RSWord* const data, const uint64_t dataSize, RSWord* const storedChunk)
+{
+    const uint64_t nsym = header.numOfErrorCorrectingSymbols;
+    
+    RSWord* out = storedChunk;
+    RSWord* parity = storedChunk + dataSize; // Sidecar
+    
+    for(uint64_t position = 0; position < dataSize; position += header.messageLength)
+    {
+        const uint64_t n = std::min(header.messageLength, dataSize - position);
+        
+        std::memcpy(out, data + position, n);
+        out += n;
+        
+        if(header.layout == ContainerLayout::Interleaved)
+        {
+            reedSolomon.CalculateParity(data + position, n, out);
+            out += nsym;
+        }
+        else
+        {
+            reedSolomon.CalculateParity(data + position, n, parity);
+            parity += nsym;
+        }
+    }
+}
+
+ContainerChunkState ContainerCodec::RepairChunk(const ContainerHeader& header, const ReedSolomon& reedSolomon, RSWord* const storedChunk, const uint64_t dataSize, uint64_t* const numOfCorrections)
+{
+    const uint64_t nsym = header.numOfErrorCorrectingSymbols;
+    
+    ContainerChunkState state = ContainerChunkState::Clean;
+    std::array<RSWord, InlinePolynomial::Capacity> codeword;
+    
+    if(numOfCorrections)
+        *numOfCorrections = 0;
+    
+    for(uint64_t position = 0, codewordIndex = 0; position < dataSize; position += header.messageLength, codewordIndex++)
+    {
+        const uint64_t n = std::min(header.messageLength, dataSize - position);
+        
+        RSWord* data = storedChunk + position;
+        RSWord* parity = storedChunk + dataSize + codewordIndex * nsym;
+        
+        if(header.layout == ContainerLayout::Interleaved)
+        {
+            data = storedChunk + codewordIndex * (header.messageLength + nsym);
+            parity = data + n;
+        }
+        
+        std::memcpy(codeword.data(), data, n);
+        std::memcpy(codeword.data() + n, parity, nsym);
+        
+        uint64_t numOfErrors = 0;
+        
+        try
+        {
+            numOfErrors = reedSolomon.DecodeInPlace(std::span<RSWord>(codeword.data(), n + nsym));
+        }
+        catch(const std::runtime_error&)
+        {
+            return ContainerChunkState::Uncorrectable;
+        }
+        
+        if(numOfErrors == 0)
+            continue;
+        
+        state = ContainerChunkState::Corrupted;
+        
+        if(numOfCorrections)
+            *numOfCorrections += numOfErrors;
+        
+        std::memcpy(data, codeword.data(), n);
+        std::memcpy(parity, codeword.data() + n, nsym);
+    }
+    
+    return state;
+}
+
+ContainerWriter::ContainerWriter(const std::filesystem::path& path, const ReedSolomon& reedSolomon, const uint64_t chunkSize, const ContainerLayout layout, const uint64_t messageLength, const bool chunkChecksums)
+    : m_ReedSolomon(&reedSolomon)
+    , m_Header(ContainerCodec::CreateHeader(reedSolomon, chunkSize, layout, messageLength, chunkChecksums))
+{
+    m_File.open(path, std::ios::binary | std::ios::trunc);
+    
+    if(!m_File)
+        throw std::runtime_error("Unable to create container file.");
+    
+    // Placeholder, rewritten by Finish()
+    const std::array<uint8_t, ContainerHeader::Size> header = ContainerCodec::SerializeHeader(m_Header);
+    m_File.write(reinterpret_cast<const char*>(header.data()), ContainerHeader::Size);
+    m_FileOffset = ContainerHeader::Size;
+    
+    m_ChunkBuffer.reserve(chunkSize);
+}
+
+ContainerWriter::~ContainerWriter()
+{
+    try
+    {
+        Finish();
+    }
+    catch(...)
+    {
+        // Destructor must not throw, call Finish() explicitly to get errors
+    }
+}
+
+void ContainerWriter::Write(std::span<const RSWord> data)
+{
+    if(m_Finished)
+        throw std::runtime_error("Container is already finished.");
+    
+    while(!data.empty())
+    {
+        const uint64_t n = std::min<uint64_t>(data.size(), m_Header.chunkSize - m_ChunkBuffer.size());
+        
+        m_ChunkBuffer.insert(m_ChunkBuffer.end(), data.begin(), data.begin() + static_cast<std::ptrdiff_t>(n));
+        data = data.subspan(n);
+        
+        if(m_ChunkBuffer.size() == m_Header.chunkSize)
+            WriteChunk();
+    }
+}
+
+void ContainerWriter::WriteChunk()
+{
+    const uint64_t dataSize = m_ChunkBuffer.size();
+    
+    m_StoredChunk.resize(m_Header.GetStoredChunkSize(dataSize));
+    ContainerCodec::EncodeChunk(m_Header, *m_ReedSolomon, m_ChunkBuffer.data(), dataSize, m_StoredChunk.data());
+    
+    m_File.write(reinterpret_cast<const char*>(m_StoredChunk.data()), static_cast<std::streamsize>(m_StoredChunk.size()));
+    
+    if(!m_File)
+        throw std::runtime_error("Unable to write container chunk.");
+    
+    const uint32_t checksum = m_Header.chunkChecksums ? CRC32C::Calculate(m_StoredChunk.data(), m_StoredChunk.size()) : 0;
+    
+    m_ChunkTable.push_back({m_FileOffset, dataSize, checksum, m_Header.chunkChecksums});
+    m_FileOffset += m_StoredChunk.size();
+    m_Header.dataSize += dataSize;
+    
+    m_ChunkBuffer.clear();
+}
+
+void ContainerWriter::Finish()
+{
+    if(m_Finished)
+        return;
+    
+    m_Finished = true;
+    
+    if(!m_ChunkBuffer.empty())
+        WriteChunk();
+    
+    m_Header.numOfChunks = m_ChunkTable.size();
+    
+    const std::vector<uint8_t> table = ContainerCodec::SerializeChunkTable(m_Header, m_ChunkTable);
+    m_File.write(reinterpret_cast<const char*>(table.data()), static_cast<std::streamsize>(table.size()));
+    
+    const std::array<uint8_t, ContainerHeader::Size> header = ContainerCodec::SerializeHeader(m_Header);
+    m_File.seekp(0);
+    m_File.write(reinterpret_cast<const char*>(header.data()), ContainerHeader::Size);
+    m_File.close();
+    
+    if(!m_File)
+        throw std::runtime_error("Unable to finish container file.");
+}
+
+ContainerReader::ContainerReader(const std::filesystem::path& path, const uint64_t cacheCapacity, const ContainerAccess access)
+    : m_Access(access)
+    , m_CacheCapacity(cacheCapacity)
+{
+    if(cacheCapacity < 1)
+        throw std::invalid_argument("Cache capacity must be at least one chunk.");
+    
+    m_File.open(path, (access == ContainerAccess::ReadWrite) ? std::ios::binary | std::ios::in | std::ios::out : std::ios::binary | std::ios::in);
+    
+    if(!m_File)
+        throw std::runtime_error("Unable to open container file.");
+    
+    ReadHeader();
+    ReadChunkTable();
+    
+    m_ReedSolomon = std::make_unique<ReedSolomon>(m_Header.bitsPerWord, m_Header.numOfErrorCorrectingSymbols);
+}
+
+void ContainerReader::ReadFromFile(const uint64_t offset, RSWord* const destination, const uint64_t length)
+{
+    m_File.seekg(static_cast<std::streamoff>(offset));
+    m_File.read(reinterpret_cast<char*>(destination), static_cast<std::streamsize>(length));
+    
+    if(!m_File)
+        throw std::runtime_error("Unable to read from container file.");
+}
+
+void ContainerReader::WriteToFile(const uint64_t offset, const RSWord* const source, const uint64_t length)
+{
+    m_File.seekp(static_cast<std::streamoff>(offset));
+    m_File.write(reinterpret_cast<const char*>(source), static_cast<std::streamsize>(length));
+    m_File.flush();
+    
+    if(!m_File)
+        throw std::runtime_error("Unable to write to container file.");
+}
+
+void ContainerReader::ReadHeader()
+{
+    m_File.seekg(0, std::ios::end);
+    const uint64_t fileSize = static_cast<uint64_t>(m_File.tellg());
+    
+    if(fileSize < ContainerHeader::Size)
+        throw std::runtime_error("Not a container file.");
+    
+    std::array<uint8_t, ContainerHeader::Size> buffer{};
+    ReadFromFile(0, buffer.data(), buffer.size());
+    
+    const uint8_t* p = buffer.data();
+    
+    try
+    {
+        m_IsHeaderCorrupted = ContainerCodec::CorrectHeader(buffer) > 0;
+    }
+    catch(const std::runtime_error&)
+    {
+        if(Load<uint32_t>(p) == ContainerHeader::Magic)
+            throw std::runtime_error("Container header is damaged beyond repair.");
+        
+        throw std::runtime_error("Not a container file.");
+    }
+    
+    if(Load<uint32_t>(p) != ContainerHeader::Magic)
+        throw std::runtime_error("Not a container file.");
+    
+    if(Load<uint16_t>(p) != ContainerHeader::FormatVersion)
+        throw std::runtime_error("Unsupported container format version.");
+    
+    m_Header.layout = static_cast<ContainerLayout>(Load<uint8_t>(p));
+    m_Header.bitsPerWord = Load<uint8_t>(p);
+    m_Header.numOfErrorCorrectingSymbols = Load<uint32_t>(p);
+    m_Header.messageLength = Load<uint32_t>(p);
+    m_Header.chunkSize = Load<uint64_t>(p);
+    m_Header.dataSize = Load<uint64_t>(p);
+    m_Header.numOfChunks = Load<uint64_t>(p);
+    m_Header.chunkChecksums = Load<uint8_t>(p) != 0;
+    
+    if(m_Header.layout != ContainerLayout::Interleaved && m_Header.layout != ContainerLayout::Sidecar)
+        throw std::runtime_error("Unknown container layout.");
+    
+    if(m_Header.bitsPerWord != 8 * sizeof(RSWord) || m_Header.messageLength == 0 || m_Header.chunkSize == 0
+       || m_Header.numOfErrorCorrectingSymbols == 0
+       || m_Header.messageLength + m_Header.numOfErrorCorrectingSymbols >= (1ULL << m_Header.bitsPerWord))
+        throw std::runtime_error("Invalid container header.");
+    
+    // Checked in this order the layout computations cannot overflow: only a file holding more than one chunk
+    // multiplies by the chunk size, which is then smaller than the data size and the file size
+    const uint64_t numOfChunks = m_Header.dataSize / m_Header.chunkSize + (m_Header.dataSize % m_Header.chunkSize != 0 ? 1 : 0);
+    
+    if(m_Header.dataSize > fileSize || m_Header.numOfChunks != numOfChunks)
+        throw std::runtime_error("Invalid container header.");
+    
+    if(m_Header.GetTableOffset() + m_Header.GetTableSize() > fileSize)
+        throw std::runtime_error("Container file is truncated.");
+}
+
+void ContainerReader::ReadChunkTable()
+{
+    m_ChunkTable = ContainerCodec::CreateChunkTable(m_Header);
+    m_IsChunkEntryCorrupted.assign(m_Header.numOfChunks, false);
+    
+    if(!m_Header.chunkChecksums)
+        return;
+    
+    std::vector<uint8_t> table(m_Header.GetTableSize());
+    ReadFromFile(m_Header.GetTableOffset(), table.data(), table.size());
+    
+    for(uint64_t i = 0; i < m_Header.numOfChunks; i++)
+    {
+        const std::span<uint8_t, ContainerChunkEntry::Size> serializedEntry(table.data() + i * ContainerChunkEntry::Size, ContainerChunkEntry::Size);
+        
+        try
+        {
+            m_IsChunkEntryCorrupted[i] = ContainerCodec::CorrectChunkEntry(serializedEntry) > 0;
+        }
+        catch(const std::runtime_error&)
+        {
+            // Checksum lost, the chunk is verified by its syndromes until the entry is rewritten
+            m_IsChunkEntryCorrupted[i] = true;
+            continue;
+        }
+        
+        const uint8_t* p = serializedEntry.data();
+        m_ChunkTable[i].checksum = Load<uint32_t>(p);
+        m_ChunkTable[i].hasChecksum = true;
+    }
+}
+
+void ContainerReader::WriteChunkEntry(const uint64_t index)
+{
+    const std::array<uint8_t, ContainerChunkEntry::Size> serializedEntry = ContainerCodec::SerializeChunkEntry(m_ChunkTable[index]);
+    
+    WriteToFile(m_Header.GetChunkEntryOffset(index), serializedEntry.data(), serializedEntry.size());
+    m_IsChunkEntryCorrupted[index] = false;
+}
+
+void ContainerReader::RepairHeader()
+{
+    if(m_Access != ContainerAccess::ReadWrite)
+        throw std::logic_error("Repairing requires a container opened for writing.");
+    
+    if(!m_IsHeaderCorrupted)
+        return;
+    
+    const std::array<uint8_t, ContainerHeader::Size> serializedHeader = ContainerCodec::SerializeHeader(m_Header);
+    
+    WriteToFile(0, serializedHeader.data(), serializedHeader.size());
+    m_IsHeaderCorrupted = false;
+}
+
+bool ContainerReader::ReadStoredChunk(const uint64_t index)
+{
+    const ContainerChunkEntry& entry = m_ChunkTable[index];
+    
+    m_StoredChunk.resize(m_Header.GetStoredChunkSize(entry.dataSize));
+    ReadFromFile(entry.offset, m_StoredChunk.data(), m_StoredChunk.size());
+    
+    return entry.hasChecksum && CRC32C::Calculate(m_StoredChunk.data(), m_StoredChunk.size()) == entry.checksum;
+}
+
+void ContainerReader::LoadCodeword(const uint64_t chunkDataSize, const uint64_t codewordIndex)
+{
+    const uint64_t nsym = m_Header.numOfErrorCorrectingSymbols;
+    const uint64_t position = codewordIndex * m_Header.messageLength;
+    const uint64_t n = std::min(m_Header.messageLength, chunkDataSize - position);
+    
+    const RSWord* data = m_StoredChunk.data() + position;
+    const RSWord* parity = m_StoredChunk.data() + chunkDataSize + codewordIndex * nsym;
+    
+    if(m_Header.layout == ContainerLayout::Interleaved)
+    {
+        data = m_StoredChunk.data() + codewordIndex * (m_Header.messageLength + nsym);
+        parity = data + n;
+    }
+    
+    m_Codeword.resize(n + nsym);
+    std::memcpy(m_Codeword.data(), data, n);
+    std::memcpy(m_Codeword.data() + n, parity, nsym);
+}
+
+std::vector<RSWord> ContainerReader::DecodeChunk(const uint64_t index)
+{
+    const uint64_t dataSize = m_ChunkTable[index].dataSize;
+    const uint64_t nsym = m_Header.numOfErrorCorrectingSymbols;
+    
+    // Checksum match: no syndromes needed
+    const bool clean = ReadStoredChunk(index);
+    
+    std::vector<RSWord> data(dataSize);
+    
+    for(uint64_t position = 0, codewordIndex = 0; position < dataSize; position += m_Header.messageLength, codewordIndex++)
+    {
+        LoadCodeword(dataSize, codewordIndex);
+        
+        if(!clean)
+        {
+            m_ReedSolomon->DecodeInPlace(m_Codeword, nullptr, &m_Corrections);
+            m_Statistics.symbolsCorrected += m_Corrections.size();
+        }
+        
+        std::memcpy(data.data() + position, m_Codeword.data(), m_Codeword.size() - nsym);
+    }
+    
+    if(clean)
+        m_Statistics.chunksVerifiedByChecksum++;
+    else
+        m_Statistics.chunksDecoded++;
+    
+    return data;
+}
+
+const std::vector<RSWord>& ContainerReader::GetChunk(const uint64_t index)
+{
+    const auto it = m_Cache.find(index);
+    
+    if(it != m_Cache.end())
+    {
+        m_Statistics.cacheHits++;
+        m_RecentlyUsed.splice(m_RecentlyUsed.begin(), m_RecentlyUsed, it->second.position);
+        
+        return it->second.data;
+    }
+    
+    std::vector<RSWord> data = DecodeChunk(index);
+    
+    // Evict least recently used
+    if(m_Cache.size() >= m_CacheCapacity && !m_RecentlyUsed.empty())
+    {
+        m_Cache.erase(m_RecentlyUsed.back());
+        m_RecentlyUsed.pop_back();
+    }
+    
+    m_RecentlyUsed.push_front(index);
+    
+    return m_Cache.insert_or_assign(index, CacheEntry{std::move(data), m_RecentlyUsed.begin()}).first->second.data;
+}
+
+void ContainerReader::Read(uint64_t offset, std::span<RSWord> destination)
+{
+    if(offset > m_Header.dataSize || destination.size() > m_Header.dataSize - offset)
+        throw std::out_of_range("Read exceeds the container data.");
+    
+    while(!destination.empty())
+    {
+        const uint64_t index = offset / m_Header.chunkSize;
+        const uint64_t chunkOffset = offset % m_Header.chunkSize;
+        
+        const std::vector<RSWord>& chunk = GetChunk(index);
+        const uint64_t n = std::min<uint64_t>(destination.size(), chunk.size() - chunkOffset);
+        
+        std::memcpy(destination.data(), chunk.data() + chunkOffset, n);
+        
+        destination = destination.subspan(n);
+        offset += n;
+    }
+}
+
+std::vector<RSWord> ContainerReader::Read(const uint64_t offset, const uint64_t length)
+{
+    std::vector<RSWord> result(length);
+    Read(offset, result);
+    
+    return result;
+}
+
+ContainerChunkState ContainerReader::VerifyChunk(const uint64_t index, const bool repair)
+{
+    if(index >= m_ChunkTable.size())
+        throw std::out_of_range("Chunk index exceeds the container.");
+    
+    if(repair && m_Access != ContainerAccess::ReadWrite)
+        throw std::logic_error("Repairing requires a container opened for writing.");
+    
+    if(ReadStoredChunk(index))
+    {
+        // Checksum entry was corrected while opening
+        if(repair && m_IsChunkEntryCorrupted[index])
+            WriteChunkEntry(index);
+        
+        m_Statistics.chunksVerifiedByChecksum++;
+        return ContainerChunkState::Clean;
+    }
+    
+    // Checksum missing or mismatch, fall back to the syndromes of every codeword.
+    // A mismatch with clean codewords means the table entry itself is damaged, the data is intact.
+    const ContainerChunkState state = ContainerCodec::RepairChunk(m_Header, *m_ReedSolomon, m_StoredChunk.data(), m_ChunkTable[index].dataSize);
+    
+    if(state == ContainerChunkState::Uncorrectable)
+        return state;
+    
+    m_Statistics.chunksDecoded++;
+    
+    if(repair)
+    {
+        ContainerChunkEntry& entry = m_ChunkTable[index];
+        
+        if(state == ContainerChunkState::Corrupted)
+            WriteToFile(entry.offset, m_StoredChunk.data(), m_StoredChunk.size());
+        
+        // Repaired chunk or damaged table entry
+        if(m_Header.chunkChecksums)
+        {
+            const uint32_t checksum = CRC32C::Calculate(m_StoredChunk.data(), m_StoredChunk.size());
+            
+            if(!entry.hasChecksum || checksum != entry.checksum || m_IsChunkEntryCorrupted[index])
+            {
+                entry.checksum = checksum;
+                entry.hasChecksum = true;
+                WriteChunkEntry(index);
+            }
+        }
+    }
+    
+    return state;
+}
+
+ContainerScrubReport ContainerReader::Scrub(const bool repair)
+{
+    ContainerScrubReport report;
+    report.metadataCorrupted = m_IsHeaderCorrupted || std::ranges::find(m_IsChunkEntryCorrupted, true) != m_IsChunkEntryCorrupted.end();
+    
+    for(uint64_t index = 0; index < m_ChunkTable.size(); index++)
+    {
+        const ContainerChunkState state = VerifyChunk(index, repair);
+        
+        if(state == ContainerChunkState::Corrupted)
+            report.corruptedChunks.push_back(index);
+        else if(state == ContainerChunkState::Uncorrectable)
+            report.uncorrectableChunks.push_back(index);
+        
+        report.chunksVerified++;
+        report.bytesVerified += m_Header.GetStoredChunkSize(m_ChunkTable[index].dataSize);
+    }
+    
+    if(repair)
+        RepairHeader();
+    
+    return report;
+}
@@ -0,0 +1,141 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  RateCompatibleCodec.cpp                                         */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#include "ReedSolomon.hpp"
+
+using namespace NReedSolomon;
+
+namespace
+{
+// Offset of row t - 1 in the triangular table, the rows before it hold 2 + 3 + ... + t coefficients
+uint64_t GetGeneratorOffset(const uint64_t numOfErrorCorrectingSymbols)
+{
+    return (numOfErrorCorrectingSymbols - 1) * (numOfErrorCorrectingSymbols + 2) / 2;
+}
+}
+
+RateCompatibleCodec::RateCompatibleCodec(const uint64_t bitsPerWord, const uint64_t maxNumOfErrorCorrectingSymbols)
+    : m_GaloisField(bitsPerWord)
+    , m_Codec(m_GaloisField, maxNumOfErrorCorrectingSymbols)
+    , m_Generators(GetGeneratorOffset(maxNumOfErrorCorrectingSymbols + 1))
+{
+    // g_1(x) = x - 1
+    m_Generators[0] = 1;
+    m_Generators[1] = 1;
+    
+    // g_t(x) = g_t-1(x) * (x - alpha^(t - 1)), subtraction is addition in characteristic 2
+    for(uint64_t t = 2; t <= maxNumOfErrorCorrectingSymbols; t++)
+    {
+        const RSWord* const previous = m_Generators.data() + GetGeneratorOffset(t - 1);
+        RSWord* const current = m_Generators.data() + GetGeneratorOffset(t);
+        const RSWord root = m_GaloisField.GetExponentialTable()[t - 1];
+        
+        current[0] = 1;
+        
+        for(uint64_t i = 1; i < t; i++)
+            current[i] = previous[i] ^ m_GaloisField.Multiply(previous[i - 1], root);
+        
+        current[t] = m_GaloisField.Multiply(previous[t - 1], root);
+    }
+}
+
+void RateCompatibleCodec::CheckNumberOfErrorCorrectingSymbols(const uint64_t numOfErrorCorrectingSymbols) const
+{
+    if(numOfErrorCorrectingSymbols < 1 || numOfErrorCorrectingSymbols > m_Codec.m_NumOfErrorCorrectingSymbols)
+        throw std::out_of_range("Number of error correction symbols is out of range.");
+}
+
+std::span<const RSWord> RateCompatibleCodec::GetGeneratorPolynomial(const uint64_t numOfErrorCorrectingSymbols) const
+{
+    CheckNumberOfErrorCorrectingSymbols(numOfErrorCorrectingSymbols);
+    
+    return {m_Generators.data() + GetGeneratorOffset(numOfErrorCorrectingSymbols), numOfErrorCorrectingSymbols + 1};
+}
+
+std::vector<RSWord> RateCompatibleCodec::Encode(const std::vector<RSWord>& message, const uint64_t numOfErrorCorrectingSymbols) const
+{
+    if(message.empty())
+        throw std::invalid_argument("Cannot encode empty message.");
+    
+    CheckNumberOfErrorCorrectingSymbols(numOfErrorCorrectingSymbols);
+    
+    std::vector<RSWord> result(message.size() + numOfErrorCorrectingSymbols);
+    std::ranges::copy(message, result.begin());
+    
+    CalculateParity(message.data(), message.size(), result.data() + message.size(), numOfErrorCorrectingSymbols);
+    
+    return result;
+}
+
+void RateCompatibleCodec::CalculateParity(const RSWord* const message, const uint64_t length, RSWord* const parity, const uint64_t numOfErrorCorrectingSymbols) const
+{
+    const std::span<const RSWord> generator = GetGeneratorPolynomial(numOfErrorCorrectingSymbols);
+    
+    std::fill_n(parity, numOfErrorCorrectingSymbols, 0);
+    m_Codec.AccumulateParity(message, length, parity, generator);
+}
+
+std::vector<RSWord> RateCompatibleCodec::Decode(const std::vector<RSWord>& data, const uint64_t numOfErrorCorrectingSymbols, const std::vector<uint64_t>* const erasurePositions, uint64_t* const numOfErrorsFound) const
+{
+    if(numOfErrorsFound)
+        *numOfErrorsFound = 0;
+    
+    if(data.empty())
+        throw std::invalid_argument("Data to be decoded cannot have length zero.");
+    
+    // Correct a copy, then cut error correcting symbols from it
+    std::vector<RSWord> result = data;
+    const uint64_t numOfErrors = DecodeInPlace(result, numOfErrorCorrectingSymbols, erasurePositions);
+    
+    if(numOfErrorsFound)
+        *numOfErrorsFound = numOfErrors;
+    
+    result.resize(data.size() - numOfErrorCorrectingSymbols);
+    
+    return result;
+}
+
+uint64_t RateCompatibleCodec::DecodeInPlace(const std::span<RSWord> codeword, const uint64_t numOfErrorCorrectingSymbols, const std::vector<uint64_t>* const erasurePositions, std::vector<Correction>* const corrections) const
+{
+    return m_Codec.DecodeInPlace(codeword, numOfErrorCorrectingSymbols, erasurePositions, corrections);
+}
+
+bool RateCompatibleCodec::IsMessageCorrupted(const std::vector<RSWord>& message, const uint64_t numOfErrorCorrectingSymbols) const
+{
+    CheckNumberOfErrorCorrectingSymbols(numOfErrorCorrectingSymbols);
+    
+    std::array<RSWord, InlinePolynomial::Capacity> syndromes;
+    m_Codec.CalculateSyndromes(message.data(), message.size(), syndromes.data(), numOfErrorCorrectingSymbols);
+    
+    return !std::all_of(syndromes.begin(), syndromes.begin() + static_cast<coef_diff_type>(numOfErrorCorrectingSymbols), [](const RSWord s) { return s == 0; });
+}
@@ -42,7 +42,41 @@ ReedSolomon::ReedSolomon(const uint64_t bitsPerWord, const uint64_t numOfErrorCo
     if(numOfErrorCorrectingSymbols < 1)
         throw std::invalid_argument("Number of error correction symbols must be greater than zero.");
     
+    // Symbols are RSWords, and the nsym + 1 coefficients of the decoder polynomials (syndromes, locators) must fit
+    // into InlinePolynomial::Capacity, which is sized for the largest codeword of such symbols
+    if(m_BitsPerWord > 8 * sizeof(RSWord))
+        throw std::invalid_argument("Bits per word exceed the size of a symbol.");
+    
     m_GaloisField = new GaloisField(m_BitsPerWord);
+    
+    // A codeword holds at least one message symbol, which also keeps nsym + 1 below InlinePolynomial::Capacity
+    if(m_NumOfErrorCorrectingSymbols >= m_GaloisField->GetCardinality() - 1)
+    {
+        delete m_GaloisField;
+        throw std::invalid_argument("Number of error correction symbols must be smaller than the maximum codeword length.");
+    }
+    
+    m_GeneratorPolynomial = new Polynomial({1}, m_GaloisField);
+    
+    CreateGeneratorPolynomial();
+}
+
+ReedSolomon::ReedSolomon(const GaloisField& galoisField, const uint64_t numOfErrorCorrectingSymbols)
+    : m_BitsPerWord(galoisField.GetExponent())
+    , m_NumOfErrorCorrectingSymbols(numOfErrorCorrectingSymbols)
+    , m_GaloisField(&galoisField)
+    , m_OwnsGaloisField(false)
+{
+    if(numOfErrorCorrectingSymbols < 1)
+        throw std::invalid_argument("Number of error correction symbols must be greater than zero.");
+    
+    // Same limits as above: symbols must fit into RSWord and codewords must hold at least one message symbol
+    if(m_BitsPerWord > 8 * sizeof(RSWord))
+        throw std::invalid_argument("Bits per word exceed the size of a symbol.");
+    
+    if(m_NumOfErrorCorrectingSymbols >= m_GaloisField->GetCardinality() - 1)
+        throw std::invalid_argument("Number of error correction symbols must be smaller than the maximum codeword length.");
+    
     m_GeneratorPolynomial = new Polynomial({1}, m_GaloisField);
     
     CreateGeneratorPolynomial();
@@ -51,17 +85,29 @@ ReedSolomon::ReedSolomon(const uint64_t bitsPerWord, const uint64_t numOfErrorCo
 ReedSolomon::ReedSolomon(const ReedSolomon& other)
     : m_BitsPerWord(other.m_BitsPerWord)
     , m_NumOfErrorCorrectingSymbols(other.m_NumOfErrorCorrectingSymbols)
+    , m_OwnsGaloisField(other.m_OwnsGaloisField)
 {
-    m_GaloisField = new GaloisField(m_BitsPerWord);
+    m_GaloisField = m_OwnsGaloisField ? new GaloisField(m_BitsPerWord) : other.m_GaloisField;
     m_GeneratorPolynomial = new Polynomial(m_GaloisField);
     if (other.m_GeneratorPolynomial == nullptr)
         throw std::invalid_argument("Generator polynomial cannot be nullptr.");
     *m_GeneratorPolynomial = *other.m_GeneratorPolynomial;
 }
 
+ReedSolomon::ReedSolomon(ReedSolomon&& other) noexcept
+    : m_BitsPerWord(other.m_BitsPerWord)
+    , m_NumOfErrorCorrectingSymbols(other.m_NumOfErrorCorrectingSymbols)
+    , m_GaloisField(std::exchange(other.m_GaloisField, nullptr))
+    , m_OwnsGaloisField(other.m_OwnsGaloisField)
+    , m_GeneratorPolynomial(std::exchange(other.m_GeneratorPolynomial, nullptr))
+{
+}
+
 ReedSolomon::~ReedSolomon()
 {
-    delete m_GaloisField;
+    if(m_OwnsGaloisField)
+        delete m_GaloisField;
+    
     delete m_GeneratorPolynomial;
 }
 
@@ -82,35 +128,90 @@ std::vector<RSWord> ReedSolomon::Encode(const std::vector<RSWord>& message) cons
     if(message.empty())
         throw std::invalid_argument("Cannot encode empty message.");
     
-    Polynomial messagePolynomial(message, m_GaloisField);
-    Polynomial remainder(m_GaloisField);
+    std::vector<RSWord> result(message.size() + m_NumOfErrorCorrectingSymbols);
+    std::ranges::copy(message, result.begin());
     
-    messagePolynomial.Enlarge(m_NumOfErrorCorrectingSymbols);
-    messagePolynomial.Divide(m_GeneratorPolynomial, nullptr, &remainder);
+    // Append error correction symbols to result
+    CalculateParity(message.data(), message.size(), result.data() + message.size());
     
-    std::vector<RSWord> result(messagePolynomial.GetNumberOfCoefficients());
+    return result;
+}
+
+std::pmr::vector<RSWord> ReedSolomon::Encode(const std::span<const RSWord> message, std::pmr::memory_resource* const resource) const
+{
+    if(message.empty())
+        throw std::invalid_argument("Cannot encode empty message.");
+    
+    std::pmr::vector<RSWord> result(message.size() + m_NumOfErrorCorrectingSymbols, resource);
     std::ranges::copy(message, result.begin());
     
-    // Append remainder to result (remainder are the error correction symbols)
-    std::ranges::copy(*remainder.GetCoefficients(), result.begin() + static_cast<coef_diff_type>(message.size()));
+    CalculateParity(message.data(), message.size(), result.data() + message.size());
     
     return result;
 }
 
-Polynomial ReedSolomon::CalculateSyndromes(const Polynomial& message) const
+void ReedSolomon::CalculateParity(const RSWord* const message, const uint64_t length, RSWord* const parity) const
+{
+    std::fill_n(parity, m_NumOfErrorCorrectingSymbols, 0);
+    AccumulateParity(message, length, parity);
+}
+
+void ReedSolomon::CalculateParity(const std::span<const std::span<const RSWord>> fragments, RSWord* const parity) const
 {
-    std::vector<RSWord> tmp(m_NumOfErrorCorrectingSymbols + 1);
-    tmp[m_NumOfErrorCorrectingSymbols] = 0; // Padding
+    std::fill_n(parity, m_NumOfErrorCorrectingSymbols, 0);
     
-    for(uint64_t i = 0; i < m_NumOfErrorCorrectingSymbols; i++)
-        tmp[m_NumOfErrorCorrectingSymbols - i - 1] = message.Evaluate(m_GaloisField->GetExponentialTable()[i]);
+    for(const std::span<const RSWord> fragment : fragments)
+        AccumulateParity(fragment.data(), fragment.size(), parity);
+}
+
+void ReedSolomon::AccumulateParity(const RSWord* const message, const uint64_t length, RSWord* const parity) const
+{
+    AccumulateParity(message, length, parity, *m_GeneratorPolynomial->GetCoefficients());
+}
+
+// LFSR form of the synthetic division by the generator polynomial, parity holds the running remainder
+void ReedSolomon::AccumulateParity(const RSWord* const message, const uint64_t length, RSWord* const parity, const std::span<const RSWord> generator) const
+{
+    const uint64_t nsym = generator.size() - 1;
+    
+    if(m_GaloisField->GetBackend() == GaloisFieldBackend::GFNI)
+    {
+        GFNI::CalculateParity(*m_GaloisField, generator.data(), nsym, message, length, parity);
+        return;
+    }
+    
+    for(uint64_t i = 0; i < length; i++)
+    {
+        const RSWord feedback = message[i] ^ parity[0];
+        
+        std::memmove(parity, parity + 1, sizeof(RSWord) * (nsym - 1));
+        parity[nsym - 1] = 0;
+        
+        // Skip log(0)
+        if(feedback == 0)
+            continue;
+        
+        for(uint64_t j = 0; j < nsym; j++)
+            parity[j] ^= m_GaloisField->Multiply(generator[j + 1], feedback);
+    }
+}
 
-    return {tmp, m_GaloisField};
+InlinePolynomial ReedSolomon::CalculateSyndromes(const Polynomial& message) const
+{
+    std::array<RSWord, InlinePolynomial::Capacity> tmp;
+    CalculateSyndromes(message.GetCoefficients()->data(), message.GetNumberOfCoefficients(), tmp.data());
+    
+    // Highest syndrome first, followed by padding
+    InlinePolynomial result(nullptr, m_NumOfErrorCorrectingSymbols + 1, m_GaloisField);
+    for(uint64_t i = 0; i < m_NumOfErrorCorrectingSymbols; i++)
+        result[m_NumOfErrorCorrectingSymbols - i - 1] = tmp[i];
+    
+    return result;
 }
 
-Polynomial ReedSolomon::CalculateForneySyndromes(const Polynomial& syndromes, const std::vector<uint64_t>* const erasurePositions, const uint64_t n) const
+InlinePolynomial ReedSolomon::CalculateForneySyndromes(const InlinePolynomial& syndromes, const std::vector<uint64_t>* const erasurePositions, const uint64_t n) const
 {
-    Polynomial forneySyndromes = syndromes;
+    InlinePolynomial forneySyndromes = syndromes;
     forneySyndromes.TrimEnd(1);
     
     if(erasurePositions)
@@ -131,8 +232,57 @@ Polynomial ReedSolomon::CalculateForneySyndromes(const Polynomial& syndromes, co
     return forneySyndromes;
 }
 
+void ReedSolomon::CalculateSyndromes(const RSWord* const data, const uint64_t length, RSWord* const syndromes) const
+{
+    std::fill_n(syndromes, m_NumOfErrorCorrectingSymbols, 0);
+    AccumulateSyndromes(data, length, syndromes);
+}
+
+void ReedSolomon::CalculateSyndromes(const std::span<const std::span<const RSWord>> fragments, RSWord* const syndromes) const
+{
+    std::fill_n(syndromes, m_NumOfErrorCorrectingSymbols, 0);
+    
+    for(const std::span<const RSWord> fragment : fragments)
+        AccumulateSyndromes(fragment.data(), fragment.size(), syndromes);
+}
+
+void ReedSolomon::CalculateSyndromes(const RSWord* const data, const uint64_t length, RSWord* const syndromes, const uint64_t numOfSyndromes) const
+{
+    std::fill_n(syndromes, numOfSyndromes, 0);
+    AccumulateSyndromes(data, length, syndromes, numOfSyndromes);
+}
+
+void ReedSolomon::AccumulateSyndromes(const RSWord* const data, const uint64_t length, RSWord* const syndromes) const
+{
+    AccumulateSyndromes(data, length, syndromes, m_NumOfErrorCorrectingSymbols);
+}
+
+// Horner's scheme for every root alpha^i of the generator polynomial
+void ReedSolomon::AccumulateSyndromes(const RSWord* const data, const uint64_t length, RSWord* const syndromes, const uint64_t numOfSyndromes) const
+{
+    if(m_GaloisField->GetBackend() == GaloisFieldBackend::GFNI)
+    {
+        GFNI::CalculateSyndromes(*m_GaloisField, data, length, numOfSyndromes, syndromes);
+        return;
+    }
+    
+    const AlignedVector<RSWord>& exponentialTable = m_GaloisField->GetExponentialTable();
+    const AlignedVector<RSWord>& logarithmicTable = m_GaloisField->GetLogarithmicTable();
+    
+    for(uint64_t i = 0; i < numOfSyndromes; i++)
+    {
+        RSWord syndrome = syndromes[i];
+        
+        // syndrome * alpha^i == exp[log(syndrome) + i]
+        for(uint64_t j = 0; j < length; j++)
+            syndrome = (syndrome == 0 ? 0 : exponentialTable[logarithmicTable[syndrome] + i]) ^ data[j];
+        
+        syndromes[i] = syndrome;
+    }
+}
+
 // ReSharper disable once CppMemberFunctionMayBeStatic
-bool ReedSolomon::CheckSyndromes(const Polynomial& syndromes) const // NOLINT(*-convert-member-functions-to-static)
+bool ReedSolomon::CheckSyndromes(const InlinePolynomial& syndromes) const // NOLINT(*-convert-member-functions-to-static)
 {
     for(uint64_t i = 0; i < syndromes.GetNumberOfCoefficients(); i++)
     {
@@ -145,60 +295,84 @@ bool ReedSolomon::CheckSyndromes(const Polynomial& syndromes) const // NOLINT(*-
 
 bool ReedSolomon::IsMessageCorrupted(const std::vector<RSWord>& message) const
 {
-    const Polynomial msg(message, m_GaloisField);
-    const Polynomial syndromes = CalculateSyndromes(msg);
+    std::array<RSWord, InlinePolynomial::Capacity> syndromes;
+    CalculateSyndromes(message.data(), message.size(), syndromes.data());
     
-    return !CheckSyndromes(syndromes);
+    return !std::all_of(syndromes.begin(), syndromes.begin() + static_cast<coef_diff_type>(m_NumOfErrorCorrectingSymbols), [](const RSWord s) { return s == 0; });
 }
 
-Polynomial ReedSolomon::CalculateErasureLocatorPolynomial(const std::vector<uint64_t>& erasurePositions) const
+bool ReedSolomon::IsMessageCorrupted(const std::span<const std::span<const RSWord>> fragments) const
 {
-    Polynomial erasureLocator({1}, m_GaloisField);
-    Polynomial factor({0, 1}, m_GaloisField);
+    std::array<RSWord, InlinePolynomial::Capacity> syndromes;
+    CalculateSyndromes(fragments, syndromes.data());
+    
+    return !std::all_of(syndromes.begin(), syndromes.begin() + static_cast<coef_diff_type>(m_NumOfErrorCorrectingSymbols), [](const RSWord s) { return s == 0; });
+}
+
+InlinePolynomial ReedSolomon::CalculateErasureLocatorPolynomial(const std::span<const uint64_t> erasurePositions) const
+{
+    InlinePolynomial erasureLocator({1}, m_GaloisField);
+    InlinePolynomial factor({0, 1}, m_GaloisField);
 
     for(const uint64_t i : erasurePositions)
     {
         factor[0] = m_GaloisField->GetExponentialTable()[i];
-        erasureLocator.Multiply(&factor);
+        erasureLocator.Multiply(factor);
     }
     
     return erasureLocator;
 }
 
 // ReSharper disable once CppMemberFunctionMayBeStatic
-Polynomial ReedSolomon::CalculateErrorEvaluatorPolynomial(const Polynomial& syndromes, const Polynomial& erasureLocatorPolynomial, const uint64_t n) const // NOLINT(*-convert-member-functions-to-static)
+InlinePolynomial ReedSolomon::CalculateErrorEvaluatorPolynomial(const InlinePolynomial& syndromes, const InlinePolynomial& erasureLocatorPolynomial, const uint64_t n) const // NOLINT(*-convert-member-functions-to-static)
 {
-    Polynomial result = syndromes;
-    result.Multiply(&erasureLocatorPolynomial);
-    result.TrimBeginning(result.GetNumberOfCoefficients() - n);
+    // Omega(x) = S(x) * Lambda(x) mod x^n, the full product of long codes exceeds the inline storage
+    InlinePolynomial result = syndromes;
+    result.MultiplyTruncated(erasureLocatorPolynomial, n);
     
     return result;
 }
 
-Polynomial ReedSolomon::CorrectErasures(const Polynomial& message, const Polynomial& syndromes, const std::vector<uint64_t>& erasurePositions) const
+Polynomial ReedSolomon::CorrectErasures(Polynomial message, const InlinePolynomial& syndromes, const std::vector<uint64_t>& erasurePositions) const
 {
-    // Convert position to coefficient degree
-    std::vector<uint64_t> coefficientPosition(erasurePositions.size());
+    std::array<RSWord, InlinePolynomial::Capacity> magnitudes;
+    CalculateErrorMagnitudes(syndromes, erasurePositions, message.GetNumberOfCoefficients(), magnitudes.data());
     
     for(uint64_t i = 0; i < erasurePositions.size(); i++)
-        coefficientPosition[i] = message.GetNumberOfCoefficients() - erasurePositions[i] - 1;
+        message[erasurePositions[i]] ^= magnitudes[i];
     
-    const Polynomial erasureLocator = CalculateErasureLocatorPolynomial(coefficientPosition);
-    const Polynomial errorEvaluator = CalculateErrorEvaluatorPolynomial(syndromes, erasureLocator, erasureLocator.GetNumberOfCoefficients());
-        
-    std::vector<RSWord> errorPositions(coefficientPosition.size());
-    for(uint64_t i = 0; i < errorPositions.size(); i++)
+    return message;
+}
+
+void ReedSolomon::CalculateErrorMagnitudes(const InlinePolynomial& syndromes, const std::span<const uint64_t> erasurePositions, const uint64_t n, RSWord* const magnitudes) const
+{
+    // The locator below holds one coefficient more than positions
+    if(erasurePositions.size() >= InlinePolynomial::Capacity)
+        throw std::runtime_error("Too many errors to correct.");
+    
+    const uint64_t numOfPositions = erasurePositions.size();
+    
+    // Convert position to coefficient degree
+    std::array<uint64_t, InlinePolynomial::Capacity> coefficientPosition;
+    
+    for(uint64_t i = 0; i < numOfPositions; i++)
+        coefficientPosition[i] = n - erasurePositions[i] - 1;
+    
+    const InlinePolynomial erasureLocator = CalculateErasureLocatorPolynomial(std::span(coefficientPosition.data(), numOfPositions));
+    const InlinePolynomial errorEvaluator = CalculateErrorEvaluatorPolynomial(syndromes, erasureLocator, erasureLocator.GetNumberOfCoefficients());
+    
+    std::array<RSWord, InlinePolynomial::Capacity> errorPositions;
+    for(uint64_t i = 0; i < numOfPositions; i++)
         errorPositions[i] = m_GaloisField->GetExponentialTable()[coefficientPosition[i]];
     
     // Forney algorithm
-    Polynomial errorMagnitude(nullptr, message.GetNumberOfCoefficients(), m_GaloisField);
-    for(uint64_t i = 0; i < errorPositions.size(); i++)
+    for(uint64_t i = 0; i < numOfPositions; i++)
     {
         const uint64_t index = m_GaloisField->GetCardinality() - 1 - coefficientPosition[i];
         const RSWord Xi = m_GaloisField->GetExponentialTable()[index];
         RSWord errorLocatorPrime = 1;
         
-        for(uint64_t j = 0; j < errorPositions.size(); j++)
+        for(uint64_t j = 0; j < numOfPositions; j++)
         {
             if(j != i)
             {
@@ -213,20 +387,15 @@ Polynomial ReedSolomon::CorrectErasures(const Polynomial& message, const Polynom
         const RSWord tmp = errorEvaluator.Evaluate(Xi);
         const RSWord y = m_GaloisField->Multiply(errorPositions[i], tmp);
         
-        errorMagnitude[erasurePositions[i]] = m_GaloisField->Divide(y, errorLocatorPrime);
+        magnitudes[i] = m_GaloisField->Divide(y, errorLocatorPrime);
     }
-    
-    Polynomial result = message;
-    result.Add(&errorMagnitude);
-    
-    return result;
 }
 
-Polynomial ReedSolomon::CalculateErrorLocatorPolynomial(const Polynomial& syndromes, const uint64_t n, const Polynomial* const erasureLocatorPolynomial, const uint64_t erasureCount) const
+InlinePolynomial ReedSolomon::CalculateErrorLocatorPolynomial(const InlinePolynomial& syndromes, const uint64_t n, const InlinePolynomial* const erasureLocatorPolynomial, const uint64_t erasureCount) const
 {
-    Polynomial errorLocations({1}, m_GaloisField);
-    Polynomial oldLocations({1}, m_GaloisField);
-    Polynomial tmp(m_GaloisField);
+    InlinePolynomial errorLocations({1}, m_GaloisField);
+    InlinePolynomial oldLocations({1}, m_GaloisField);
+    InlinePolynomial tmp(m_GaloisField);
     
     if(erasureLocatorPolynomial)
     {
@@ -264,7 +433,7 @@ Polynomial ReedSolomon::CalculateErrorLocatorPolynomial(const Polynomial& syndro
             }
             
             tmp = oldLocations * delta;
-            errorLocations.Add(&tmp);
+            errorLocations.Add(tmp);
         }
     }
     
@@ -275,25 +444,27 @@ Polynomial ReedSolomon::CalculateErrorLocatorPolynomial(const Polynomial& syndro
     
     errorLocations.TrimBeginning(leadingZeros);
 
+    // numErrors * 2 - erasureCount > n, without unsigned underflow for erasure only codewords
     const uint64_t numErrors = errorLocations.GetNumberOfCoefficients() - 1;
-    if(numErrors * 2 - erasureCount > n)
+    if(numErrors * 2 > n + erasureCount)
         throw std::runtime_error("Too many errors to correct.");
     
     return errorLocations;
 }
 
-std::vector<uint64_t> ReedSolomon::FindErrors(const Polynomial &errorLocatorPolynomial,
-                                              const uint64_t messageLength) const
+std::pmr::vector<uint64_t> ReedSolomon::FindErrors(const InlinePolynomial &errorLocatorPolynomial,
+                                                   const uint64_t messageLength,
+                                                   std::pmr::memory_resource* const resource) const
 {
-    std::vector<uint64_t> result;
+    std::pmr::vector<uint64_t> result(resource);
     
     const uint64_t numErrors = errorLocatorPolynomial.GetNumberOfCoefficients() - 1;
-    Polynomial reverseErrorLocator = errorLocatorPolynomial;
+    InlinePolynomial reverseErrorLocator = errorLocatorPolynomial;
     reverseErrorLocator.Reverse();
     
     if(errorLocatorPolynomial.GetNumberOfCoefficients() > 2)
     {
-        result = reverseErrorLocator.ChienSearch(messageLength);
+        result = reverseErrorLocator.ChienSearch(messageLength, resource);
     }
     else if(errorLocatorPolynomial.GetNumberOfCoefficients() == 2)
     {
@@ -328,49 +499,204 @@ std::vector<RSWord> ReedSolomon::Decode(const std::vector<RSWord>& data, const s
     if(data.empty())
         throw std::invalid_argument("Data to be decoded cannot have length zero.");
     
-    Polynomial messagePolynomial(data, m_GaloisField);
+    // Correct a copy, then cut error correcting symbols from it
+    std::vector<RSWord> result = data;
+    const uint64_t numOfErrors = DecodeInPlace(result, erasurePositions);
     
-    // Do we know the erasure positions?
-    if(erasurePositions)
+    if(numOfErrorsFound)
+        *numOfErrorsFound = numOfErrors;
+    
+    result.resize(data.size() - m_NumOfErrorCorrectingSymbols);
+    
+    return result;
+}
+
+std::pmr::vector<RSWord> ReedSolomon::Decode(const std::span<const RSWord> data, std::pmr::memory_resource* const resource, const std::vector<uint64_t>* const erasurePositions, uint64_t* const numOfErrorsFound) const
+{
+    if(numOfErrorsFound)
+        *numOfErrorsFound = 0;
+    
+    if(data.empty())
+        throw std::invalid_argument("Data to be decoded cannot have length zero.");
+    
+    std::pmr::vector<RSWord> result(data.begin(), data.end(), resource);
+    const uint64_t numOfErrors = DecodeInPlace(result, erasurePositions);
+    
+    if(numOfErrorsFound)
+        *numOfErrorsFound = numOfErrors;
+    
+    result.resize(data.size() - m_NumOfErrorCorrectingSymbols);
+    
+    return result;
+}
+
+uint64_t ReedSolomon::DecodeInPlace(const std::span<RSWord> codeword, const std::vector<uint64_t>* const erasurePositions, std::vector<Correction>* const corrections) const
+{
+    return DecodeInPlace(codeword, m_NumOfErrorCorrectingSymbols, erasurePositions, corrections);
+}
+
+uint64_t ReedSolomon::DecodeInPlace(const std::span<RSWord> codeword, const uint64_t numOfErrorCorrectingSymbols, const std::vector<uint64_t>* const erasurePositions, std::vector<Correction>* const corrections) const
+{
+    const uint64_t nsym = numOfErrorCorrectingSymbols;
+    
+    if(nsym < 1 || nsym > m_NumOfErrorCorrectingSymbols)
+        throw std::out_of_range("Number of error correction symbols is out of range.");
+    
+    if(corrections)
+        corrections->clear();
+    
+    if(codeword.size() <= nsym)
+        throw std::invalid_argument("Data to be decoded must be longer than the number of error correction symbols.");
+    
+    const uint64_t numOfErasures = erasurePositions ? erasurePositions->size() : 0;
+    
+    if(numOfErasures > nsym)
+        throw std::runtime_error("Too many erasures to be corrected.");
+    
+    // Clean codewords are never written to
+    std::array<RSWord, InlinePolynomial::Capacity> rawSyndromes;
+    
+    CalculateSyndromes(codeword.data(), codeword.size(), rawSyndromes.data(), nsym);
+    
+    if(std::all_of(rawSyndromes.begin(), rawSyndromes.begin() + static_cast<coef_diff_type>(nsym), [](const RSWord s) { return s == 0; }))
+        return 0;
+    
+    // Syndromes of the codeword with zeroed erasures: remove their contribution instead of modifying the buffer
+    for(uint64_t e = 0; e < numOfErasures; e++)
     {
-        if(erasurePositions->size() > m_NumOfErrorCorrectingSymbols)
-            throw std::runtime_error("Too many erasures to be corrected.");
+        const uint64_t position = (*erasurePositions)[e];
         
-        // Zero out erasure positions in message
-        for(const uint64_t i : *erasurePositions)
-            messagePolynomial[i] = 0;
+        if(position >= codeword.size())
+            throw std::out_of_range("Erasure position is outside of the codeword.");
+        
+        // Duplicates are zeroed only once
+        if(codeword[position] == 0 || std::find(erasurePositions->begin(), erasurePositions->begin() + static_cast<coef_diff_type>(e), position) != erasurePositions->begin() + static_cast<coef_diff_type>(e))
+            continue;
+        
+        const uint64_t degree = codeword.size() - position - 1;
+        
+        for(uint64_t i = 0; i < nsym; i++)
+        {
+            const uint64_t exponent = (i * degree) % (m_GaloisField->GetCardinality() - 1);
+            rawSyndromes[i] ^= m_GaloisField->Multiply(codeword[position], m_GaloisField->GetExponentialTable()[exponent]);
+        }
     }
     
-    const Polynomial syndromes = CalculateSyndromes(messagePolynomial);
+    // Highest syndrome first, followed by padding
+    InlinePolynomial syndromes(nullptr, nsym + 1, m_GaloisField);
+    for(uint64_t i = 0; i < nsym; i++)
+        syndromes[nsym - i - 1] = rawSyndromes[i];
+    
+    // Erasure positions first, then error positions
+    std::array<uint64_t, 2 * InlinePolynomial::Capacity> errorPositions;
+    uint64_t numOfPositions = numOfErasures;
+    uint64_t numOfErrors = 0;
+    std::array<RSWord, InlinePolynomial::Capacity> magnitudes{};
+    
+    if(erasurePositions)
+        std::ranges::copy(*erasurePositions, errorPositions.begin());
     
-    // Is message corrupted?
+    // Is message corrupted apart from the erasures?
     if(!CheckSyndromes(syndromes))
     {
         // Repair
-        const Polynomial forneySyndromes = CalculateForneySyndromes(syndromes, erasurePositions, data.size());
-        const Polynomial errorLocator = CalculateErrorLocatorPolynomial(forneySyndromes, m_NumOfErrorCorrectingSymbols, nullptr, erasurePositions ? erasurePositions->size() : 0);
+        const InlinePolynomial forneySyndromes = CalculateForneySyndromes(syndromes, erasurePositions, codeword.size());
+        const InlinePolynomial errorLocator = CalculateErrorLocatorPolynomial(forneySyndromes, nsym, nullptr, numOfErasures);
         
-        std::vector<uint64_t> errorPositions = FindErrors(errorLocator, data.size());
+        // Error positions on the stack, the Chien search reserves one entry per coefficient
+        std::array<std::byte, InlinePolynomial::Capacity * sizeof(uint64_t) + 64> buffer;
+        std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size());
         
-        if(numOfErrorsFound)
-            *numOfErrorsFound = errorPositions.size();
+        const std::pmr::vector<uint64_t> foundErrors = FindErrors(errorLocator, codeword.size(), &arena);
+        numOfErrors = foundErrors.size();
         
-        if(errorPositions.empty() && (!erasurePositions || erasurePositions->empty()))
+        if(foundErrors.empty() && numOfErasures == 0)
             throw std::runtime_error("Unable to locate errors.");
         
-        // Append erasure positions to error positions vector
-        if(erasurePositions)
+        std::ranges::copy(foundErrors, errorPositions.begin() + static_cast<coef_diff_type>(numOfPositions));
+        numOfPositions += numOfErrors;
+        
+        CalculateErrorMagnitudes(syndromes, std::span(errorPositions.data(), numOfPositions), codeword.size(), magnitudes.data());
+    }
+    
+    // Write back only symbols that actually change
+    for(uint64_t k = 0; k < numOfPositions; k++)
+    {
+        const uint64_t position = errorPositions[k];
+        const RSWord corrected = (k < numOfErasures ? 0 : codeword[position]) ^ magnitudes[k];
+        const RSWord delta = codeword[position] ^ corrected;
+        
+        if(delta == 0)
+            continue;
+        
+        codeword[position] = corrected;
+        
+        if(corrections)
+            corrections->push_back({position, delta});
+    }
+    
+    return numOfErrors;
+}
+
+bool ReedSolomon::DecodeErasuresInPlace(const std::span<RSWord> codeword, const std::vector<uint64_t>& erasurePositions, std::vector<Correction>* const corrections) const
+{
+    if(corrections)
+        corrections->clear();
+    
+    if(codeword.size() <= m_NumOfErrorCorrectingSymbols)
+        throw std::invalid_argument("Data to be decoded must be longer than the number of error correction symbols.");
+    
+    if(erasurePositions.size() > m_NumOfErrorCorrectingSymbols)
+        throw std::runtime_error("Too many erasures to be corrected.");
+    
+    if(std::ranges::any_of(erasurePositions, [&](const uint64_t position) { return position >= codeword.size(); }))
+        throw std::out_of_range("Erasure position is outside of the codeword.");
+    
+    std::array<RSWord, InlinePolynomial::Capacity> rawSyndromes;
+    CalculateSyndromes(codeword.data(), codeword.size(), rawSyndromes.data());
+    
+    const auto syndromesEnd = rawSyndromes.begin() + static_cast<coef_diff_type>(m_NumOfErrorCorrectingSymbols);
+    
+    if(std::all_of(rawSyndromes.begin(), syndromesEnd, [](const RSWord s) { return s == 0; }))
+        return true;
+    
+    if(erasurePositions.empty())
+        return false;
+    
+    // Highest syndrome first, followed by padding
+    InlinePolynomial syndromes(nullptr, m_NumOfErrorCorrectingSymbols + 1, m_GaloisField);
+    for(uint64_t i = 0; i < m_NumOfErrorCorrectingSymbols; i++)
+        syndromes[m_NumOfErrorCorrectingSymbols - i - 1] = rawSyndromes[i];
+    
+    // Magnitudes relative to the current symbols, assuming all errors are at the erasure positions
+    std::array<RSWord, InlinePolynomial::Capacity> magnitudes{};
+    CalculateErrorMagnitudes(syndromes, erasurePositions, codeword.size(), magnitudes.data());
+    
+    // The assumption holds if the magnitudes cancel all syndromes: S_i ^= magnitude * X^i
+    for(uint64_t k = 0; k < erasurePositions.size(); k++)
+    {
+        const uint64_t degree = codeword.size() - erasurePositions[k] - 1;
+        
+        for(uint64_t i = 0; i < m_NumOfErrorCorrectingSymbols; i++)
         {
-            errorPositions.insert(errorPositions.begin(), erasurePositions->begin(), erasurePositions->end());
+            const uint64_t exponent = (i * degree) % (m_GaloisField->GetCardinality() - 1);
+            rawSyndromes[i] ^= m_GaloisField->Multiply(magnitudes[k], m_GaloisField->GetExponentialTable()[exponent]);
         }
-        
-        // Correct errors
-        messagePolynomial = CorrectErasures(messagePolynomial, syndromes, errorPositions);
     }
     
-    // Cut error correcting symbols from message and return message
-    std::vector<RSWord> result(data.size() - m_NumOfErrorCorrectingSymbols);
-    std::copy(messagePolynomial.GetCoefficients()->begin(), messagePolynomial.GetCoefficients()->end() - static_cast<coef_diff_type>(m_NumOfErrorCorrectingSymbols), result.begin());
+    if(!std::all_of(rawSyndromes.begin(), syndromesEnd, [](const RSWord s) { return s == 0; }))
+        return false;
     
-    return result;
+    for(uint64_t k = 0; k < erasurePositions.size(); k++)
+    {
+        if(magnitudes[k] == 0)
+            continue;
+        
+        codeword[erasurePositions[k]] ^= magnitudes[k];
+        
+        if(corrections)
+            corrections->push_back({erasurePositions[k], magnitudes[k]});
+    }
+    
+    return true;
 }
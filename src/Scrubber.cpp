@@ -0,0 +1,190 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  Scrubber.cpp                                                    */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#include "ReedSolomon.hpp"
+
+using namespace NReedSolomon;
+
+RateLimiter::RateLimiter(const uint64_t maxBytesPerSecond, const uint64_t maxOperationsPerSecond)
+    : m_MaxBytesPerSecond(maxBytesPerSecond)
+    , m_MaxOperationsPerSecond(maxOperationsPerSecond)
+    , m_NextSlot(std::chrono::steady_clock::now())
+{
+}
+
+void RateLimiter::Acquire(const uint64_t numOfBytes)
+{
+    if(m_MaxBytesPerSecond == 0 && m_MaxOperationsPerSecond == 0)
+        return;
+    
+    // Duration of this operation at the configured rates, the slower limit wins
+    std::chrono::duration<double> cost(0.0);
+    
+    if(m_MaxBytesPerSecond > 0)
+        cost = std::max(cost, std::chrono::duration<double>(static_cast<double>(numOfBytes) / static_cast<double>(m_MaxBytesPerSecond)));
+    
+    if(m_MaxOperationsPerSecond > 0)
+        cost = std::max(cost, std::chrono::duration<double>(1.0 / static_cast<double>(m_MaxOperationsPerSecond)));
+    
+    std::chrono::steady_clock::time_point start;
+    
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        
+        // Idle time is not saved up, no bursts after a pause
+        start = std::max(m_NextSlot, std::chrono::steady_clock::now());
+        m_NextSlot = start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(cost);
+    }
+    
+    std::this_thread::sleep_until(start);
+}
+
+Scrubber::Scrubber(const ScrubberSettings& settings)
+    : m_Settings(settings)
+    , m_RateLimiter(settings.maxBytesPerSecond, settings.maxOperationsPerSecond)
+    , m_ThreadPool(settings.numOfThreads)
+{
+}
+
+ContainerScrubReport Scrubber::ScrubFile(const std::filesystem::path& path)
+{
+    const ContainerAccess access = m_Settings.repair ? ContainerAccess::ReadWrite : ContainerAccess::ReadOnly;
+    
+    // Opened here first, so a broken header or table is reported before any worker starts
+    auto firstReader = std::make_shared<ContainerReader>(path, 1, access);
+    const uint64_t numOfChunks = firstReader->GetNumberOfChunks();
+    
+    auto nextChunk = std::make_shared<std::atomic<uint64_t>>(0);
+    std::vector<std::future<ContainerScrubReport>> results;
+    
+    for(uint64_t worker = 0; worker < std::min(m_ThreadPool.GetNumberOfThreads(), numOfChunks); worker++)
+    {
+        results.push_back(m_ThreadPool.Submit([this, path, access, nextChunk, numOfChunks, reader = (worker == 0) ? firstReader : nullptr]() mutable
+        {
+            if(!reader)
+                reader = std::make_shared<ContainerReader>(path, 1, access);
+            
+            ContainerScrubReport report;
+            
+            for(uint64_t index = (*nextChunk)++; index < numOfChunks && !m_IsCancelled; index = (*nextChunk)++)
+            {
+                const uint64_t storedSize = reader->GetHeader().GetStoredChunkSize(reader->GetChunkEntry(index).dataSize);
+                m_RateLimiter.Acquire(storedSize);
+                
+                report.metadataCorrupted |= reader->IsChunkEntryCorrupted(index);
+                
+                const ContainerChunkState state = reader->VerifyChunk(index, m_Settings.repair);
+                
+                if(state == ContainerChunkState::Corrupted)
+                {
+                    report.corruptedChunks.push_back(index);
+                    
+                    // The repaired chunk was written back in full, it counts against the limits like a read
+                    if(m_Settings.repair)
+                        m_RateLimiter.Acquire(storedSize);
+                }
+                else if(state == ContainerChunkState::Uncorrectable)
+                    report.uncorrectableChunks.push_back(index);
+                
+                report.chunksVerified++;
+                report.bytesVerified += storedSize;
+            }
+            
+            return report;
+        }));
+    }
+    
+    // Wait for all workers before rethrowing, they reference this file's state
+    ContainerScrubReport result;
+    std::exception_ptr error;
+    
+    result.metadataCorrupted = firstReader->IsHeaderCorrupted();
+    
+    for(std::future<ContainerScrubReport>& future : results)
+    {
+        try
+        {
+            ContainerScrubReport report = future.get();
+            
+            result.metadataCorrupted |= report.metadataCorrupted;
+            result.chunksVerified += report.chunksVerified;
+            result.bytesVerified += report.bytesVerified;
+            result.corruptedChunks.insert(result.corruptedChunks.end(), report.corruptedChunks.begin(), report.corruptedChunks.end());
+            result.uncorrectableChunks.insert(result.uncorrectableChunks.end(), report.uncorrectableChunks.begin(), report.uncorrectableChunks.end());
+        }
+        catch(...)
+        {
+            error = std::current_exception();
+        }
+    }
+    
+    if(error)
+        std::rethrow_exception(error);
+    
+    // Chunk entries were rewritten by the workers verifying their chunks
+    if(m_Settings.repair)
+        firstReader->RepairHeader();
+    
+    std::ranges::sort(result.corruptedChunks);
+    std::ranges::sort(result.uncorrectableChunks);
+    
+    return result;
+}
+
+std::vector<ScrubFileReport> Scrubber::Scrub(const std::vector<std::filesystem::path>& files)
+{
+    std::vector<ScrubFileReport> reports;
+    reports.reserve(files.size());
+    
+    for(const std::filesystem::path& path : files)
+    {
+        if(m_IsCancelled)
+            break;
+        
+        ScrubFileReport fileReport;
+        fileReport.path = path;
+        
+        try
+        {
+            fileReport.report = ScrubFile(path);
+        }
+        catch(const std::exception& exception)
+        {
+            fileReport.error = exception.what();
+        }
+        
+        reports.push_back(std::move(fileReport));
+    }
+    
+    return reports;
+}
@@ -0,0 +1,169 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  SubBlockCodec.cpp                                               */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#include "ReedSolomon.hpp"
+
+using namespace NReedSolomon;
+
+SubBlockCodec::SubBlockCodec(const ReedSolomon& reedSolomon, const uint64_t subBlockSize)
+    : m_ReedSolomon(&reedSolomon)
+    , m_SubBlockSize(subBlockSize)
+{
+    if(subBlockSize < 1)
+        throw std::invalid_argument("Sub-block size cannot be smaller than one symbol.");
+}
+
+RSWord SubBlockCodec::CalculateChecksum(const RSWord* const data, const uint64_t length) const
+{
+    return static_cast<RSWord>(CRC32C::Calculate(data, length) & ((1U << m_ReedSolomon->m_BitsPerWord) - 1));
+}
+
+bool SubBlockCodec::AreChecksumsValid(const RSWord* const codeword, const uint64_t messageLength) const
+{
+    for(uint64_t b = 0; b < GetNumberOfSubBlocks(messageLength); b++)
+    {
+        const uint64_t first = b * m_SubBlockSize;
+        
+        if(CalculateChecksum(codeword + first, std::min(m_SubBlockSize, messageLength - first)) != codeword[messageLength + b])
+            return false;
+    }
+    
+    return true;
+}
+
+uint64_t SubBlockCodec::GetMessageLength(const uint64_t codewordLength) const
+{
+    if(codewordLength <= m_ReedSolomon->m_NumOfErrorCorrectingSymbols)
+        throw std::invalid_argument("Data length does not match a sub-block encoded codeword.");
+    
+    // Message and checksums take m + ceil(m / subBlockSize) symbols, m is the smallest message length reaching it
+    const uint64_t protectedLength = codewordLength - m_ReedSolomon->m_NumOfErrorCorrectingSymbols;
+    
+    uint64_t messageLength = protectedLength * m_SubBlockSize / (m_SubBlockSize + 1);
+    while(messageLength + GetNumberOfSubBlocks(messageLength) < protectedLength)
+        messageLength++;
+    
+    if(messageLength == 0 || messageLength + GetNumberOfSubBlocks(messageLength) != protectedLength)
+        throw std::invalid_argument("Data length does not match a sub-block encoded codeword.");
+    
+    return messageLength;
+}
+
+std::vector<RSWord> SubBlockCodec::Encode(const std::vector<RSWord>& message) const
+{
+    const uint64_t numOfSubBlocks = GetNumberOfSubBlocks(message.size());
+    
+    std::vector<RSWord> protectedMessage(message);
+    protectedMessage.resize(message.size() + numOfSubBlocks);
+    
+    for(uint64_t b = 0; b < numOfSubBlocks; b++)
+    {
+        const uint64_t first = b * m_SubBlockSize;
+        protectedMessage[message.size() + b] = CalculateChecksum(message.data() + first, std::min(m_SubBlockSize, message.size() - first));
+    }
+    
+    return m_ReedSolomon->Encode(protectedMessage);
+}
+
+std::vector<RSWord> SubBlockCodec::Decode(const std::vector<RSWord>& data, uint64_t* const numOfErasedSubBlocks, uint64_t* const numOfErrorsFound) const
+{
+    if(numOfErasedSubBlocks)
+        *numOfErasedSubBlocks = 0;
+    
+    if(numOfErrorsFound)
+        *numOfErrorsFound = 0;
+    
+    const uint64_t messageLength = GetMessageLength(data.size());
+    
+    std::vector<RSWord> codeword(data);
+    std::vector<uint64_t> erasurePositions;
+    
+    for(uint64_t b = 0; b < GetNumberOfSubBlocks(messageLength); b++)
+    {
+        const uint64_t first = b * m_SubBlockSize;
+        const uint64_t length = std::min(m_SubBlockSize, messageLength - first);
+        
+        // A damaged checksum erases an intact sub-block, the fallback then finds the checksum as an error
+        if(CalculateChecksum(codeword.data() + first, length) == data[messageLength + b])
+            continue;
+        
+        if(numOfErasedSubBlocks)
+            (*numOfErasedSubBlocks)++;
+        
+        for(uint64_t i = first; i < first + length; i++)
+            erasurePositions.push_back(i);
+    }
+    
+    const bool erasuresUsable = erasurePositions.size() <= m_ReedSolomon->m_NumOfErrorCorrectingSymbols;
+    bool isDecoded = false;
+    
+    // Fast path, also covers clean codewords
+    if(erasuresUsable && m_ReedSolomon->DecodeErasuresInPlace(codeword, erasurePositions))
+        isDecoded = AreChecksumsValid(codeword.data(), messageLength);
+    
+    // Checksums inconclusive: errors and erasures, then errors only. A damaged checksum erases an intact sub-block
+    // and is an unknown error itself, which may exceed the parity where errors only decoding would not. A result
+    // is only taken if all checksums match, so the codec never corrects less than plain decoding.
+    uint64_t numOfErrors = 0;
+    
+    if(!isDecoded && erasuresUsable && !erasurePositions.empty())
+    {
+        codeword.assign(data.begin(), data.end());
+        
+        try
+        {
+            numOfErrors = m_ReedSolomon->DecodeInPlace(codeword, &erasurePositions);
+            isDecoded = AreChecksumsValid(codeword.data(), messageLength);
+        }
+        catch(const std::runtime_error&)
+        {
+            // Beyond the parity, errors only below
+        }
+    }
+    
+    if(!isDecoded)
+    {
+        codeword.assign(data.begin(), data.end());
+        numOfErrors = m_ReedSolomon->DecodeInPlace(codeword);
+        
+        if(!AreChecksumsValid(codeword.data(), messageLength))
+            throw std::runtime_error("Sub-block checksums do not match the corrected codeword.");
+    }
+    
+    if(numOfErrorsFound)
+        *numOfErrorsFound = numOfErrors;
+    
+    codeword.resize(messageLength);
+    
+    return codeword;
+}
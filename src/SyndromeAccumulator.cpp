@@ -0,0 +1,92 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  SyndromeAccumulator.cpp                                         */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#include "ReedSolomon.hpp"
+
+using namespace NReedSolomon;
+
+SyndromeAccumulator::SyndromeAccumulator(const ReedSolomon& reedSolomon)
+    : m_ReedSolomon(&reedSolomon)
+    , m_UseGFNI(reedSolomon.m_GaloisField->GetBackend() == GaloisFieldBackend::GFNI)
+{
+    if(m_UseGFNI)
+    {
+        const GaloisField* const galoisField = reedSolomon.m_GaloisField;
+        
+        for(uint64_t i = 0; i < reedSolomon.m_NumOfErrorCorrectingSymbols; i++)
+            m_Roots[i] = galoisField->ToHardwareDomain(galoisField->GetExponentialTable()[i]);
+    }
+}
+
+void SyndromeAccumulator::Reset()
+{
+    m_Syndromes.fill(0);
+    m_Length = 0;
+}
+
+void SyndromeAccumulator::Update(const RSWord symbol)
+{
+    Update(std::span<const RSWord>(&symbol, 1));
+}
+
+void SyndromeAccumulator::Update(const std::span<const RSWord> fragment)
+{
+    if(fragment.empty())
+        return;
+    
+    const uint64_t nsym = m_ReedSolomon->m_NumOfErrorCorrectingSymbols;
+    
+    if(m_UseGFNI)
+        GFNI::AccumulateSyndromes(*m_ReedSolomon->m_GaloisField, m_Roots.data(), fragment.data(), fragment.size(), nsym, m_Syndromes.data());
+    else
+        m_ReedSolomon->AccumulateSyndromes(fragment.data(), fragment.size(), m_Syndromes.data());
+    
+    m_Length += fragment.size();
+}
+
+bool SyndromeAccumulator::IsCorrupted() const
+{
+    const uint64_t nsym = m_ReedSolomon->m_NumOfErrorCorrectingSymbols;
+    
+    return !std::all_of(m_Syndromes.begin(), m_Syndromes.begin() + static_cast<coef_diff_type>(nsym), [](const RSWord s) { return s == 0; });
+}
+
+void SyndromeAccumulator::GetSyndromes(RSWord* const syndromes) const
+{
+    const uint64_t nsym = m_ReedSolomon->m_NumOfErrorCorrectingSymbols;
+    
+    if(m_UseGFNI)
+        GFNI::MultiplyRegion(syndromes, m_Syndromes.data(), m_ReedSolomon->m_GaloisField->GetFromHardwareDomainMatrix(), nsym, false);
+    else
+        std::copy_n(m_Syndromes.begin(), nsym, syndromes);
+}
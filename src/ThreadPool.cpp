@@ -0,0 +1,104 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  ThreadPool.cpp                                                  */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#include "ReedSolomon.hpp"
+
+using namespace NReedSolomon;
+
+ThreadPool::ThreadPool(uint64_t numOfThreads, const std::function<void(uint64_t)>& initializeWorker)
+{
+    if(numOfThreads == 0)
+        numOfThreads = std::max(1U, std::thread::hardware_concurrency());
+    
+    m_Workers.reserve(numOfThreads);
+    
+    for(uint64_t i = 0; i < numOfThreads; i++)
+    {
+        m_Workers.emplace_back([this, i, initializeWorker]()
+        {
+            if(initializeWorker)
+                initializeWorker(i);
+            
+            WorkerLoop();
+        });
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        const std::lock_guard<std::mutex> lock(m_Mutex);
+        m_IsStopping = true;
+    }
+    
+    m_Condition.notify_all();
+    
+    // Workers drain the remaining tasks before they exit
+    for(std::thread& worker : m_Workers)
+        worker.join();
+}
+
+void ThreadPool::Enqueue(std::function<void()> task)
+{
+    {
+        const std::lock_guard<std::mutex> lock(m_Mutex);
+        
+        if(m_IsStopping)
+            throw std::runtime_error("Cannot submit task to a stopping thread pool.");
+        
+        m_Tasks.push_back(std::move(task));
+    }
+    
+    m_Condition.notify_one();
+}
+
+void ThreadPool::WorkerLoop()
+{
+    while(true)
+    {
+        std::function<void()> task;
+        
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_Condition.wait(lock, [this]() { return m_IsStopping || !m_Tasks.empty(); });
+            
+            if(m_Tasks.empty())
+                return; // Stopping and nothing left to do
+            
+            task = std::move(m_Tasks.front());
+            m_Tasks.pop_front();
+        }
+        
+        task();
+    }
+}
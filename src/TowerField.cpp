@@ -0,0 +1,307 @@
+/*
+    The zlib License
+
+    Copyright (C) 2024 Marc Schöndorf
+ 
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+1.  The origin of this software must not be misrepresented; you must not claim
+    that you wrote the original software. If you use this software in a product,
+    an acknowledgment in the product documentation would be appreciated but is
+    not required.
+
+2.  Altered source versions must be plainly marked as such, and must not be
+    misrepresented as being the original software.
+
+3.  This notice may not be removed or altered from any source distribution.
+*/
+
+/*------------------------------------------------------------------*/
+/*                                                                  */
+/*                      (C) 2024 Marc Schöndorf                     */
+/*                            See license                           */
+/*                                                                  */
+/*  TowerField.cpp                                                  */
+/*  Created: 19.10.2026                                             */
+/*------------------------------------------------------------------*/
+
+#include "ReedSolomon.hpp"
+
+using namespace NReedSolomon;
+
+namespace
+{
+constexpr RSWord High(const RSWord16 x)
+{
+    return static_cast<RSWord>(x >> 8);
+}
+
+constexpr RSWord Low(const RSWord16 x)
+{
+    return static_cast<RSWord>(x & 0xFF);
+}
+
+constexpr RSWord16 Combine(const RSWord high, const RSWord low)
+{
+    return static_cast<RSWord16>((high << 8) | low);
+}
+
+// Regions shorter than this do not amortize building a product table
+constexpr uint64_t MinProductTableLength = 256;
+
+// (a1 y + a0)(f1 y + f0) = (a1 (f1 + f0) + a0 f1) y + a1 mu f1 + a0 f0, the logarithms of the four
+// constant factors are looked up once and every symbol costs two logarithms and up to four powers
+template<bool Accumulate>
+void MultiplyShortRegion(const TowerField& field, RSWord16* const destination, const RSWord16* const source, const RSWord16 factor, const uint64_t length)
+{
+    const GaloisField& baseField = field.GetBaseField();
+    const RSWord* const exponential = baseField.GetExponentialTable().data();
+    const RSWord* const logarithm = baseField.GetLogarithmicTable().data();
+    
+    const RSWord f1 = High(factor), f0 = Low(factor);
+    const std::array<RSWord, 4> constants = { static_cast<RSWord>(f1 ^ f0), baseField.Multiply(field.GetMu(), f1), f1, f0 };
+    
+    std::array<uint32_t, 4> logConstants{};
+    for(uint64_t k = 0; k < constants.size(); k++)
+        logConstants[k] = logarithm[constants[k]];
+    
+    for(uint64_t i = 0; i < length; i++)
+    {
+        const RSWord a1 = High(source[i]), a0 = Low(source[i]);
+        RSWord high = 0, low = 0;
+        
+        if(a1 != 0)
+        {
+            const uint32_t logA1 = logarithm[a1];
+            
+            if(constants[0] != 0)
+                high ^= exponential[logA1 + logConstants[0]];
+            if(constants[1] != 0)
+                low ^= exponential[logA1 + logConstants[1]];
+        }
+        
+        if(a0 != 0)
+        {
+            const uint32_t logA0 = logarithm[a0];
+            
+            if(constants[2] != 0)
+                high ^= exponential[logA0 + logConstants[2]];
+            if(constants[3] != 0)
+                low ^= exponential[logA0 + logConstants[3]];
+        }
+        
+        if constexpr(Accumulate)
+            destination[i] ^= Combine(high, low);
+        else
+            destination[i] = Combine(high, low);
+    }
+}
+}
+
+TowerField::TowerField(const bool allowHardwareAcceleration)
+    : m_BaseField(8, allowHardwareAcceleration)
+{
+    FindMu();
+    PrecomputeLogarithmTables();
+}
+
+// y^2 + y + mu has a root in GF(2^8) iff trace(mu) = mu + mu^2 + mu^4 + ... + mu^128 is 0
+void TowerField::FindMu()
+{
+    for(uint64_t candidate = 1; candidate < 256 && m_Mu == 0; candidate++)
+    {
+        RSWord trace = 0;
+        RSWord power = static_cast<RSWord>(candidate);
+        
+        for(uint64_t k = 0; k < 8; k++)
+        {
+            trace ^= power;
+            power = m_BaseField.Multiply(power, power);
+        }
+        
+        if(trace == 1)
+            m_Mu = static_cast<RSWord>(candidate);
+    }
+    
+    if(m_Mu == 0)
+        throw std::logic_error("No irreducible polynomial for the tower field.");
+    
+    for(uint64_t x = 0; x < 256; x++)
+        m_MultiplyByMu[x] = m_BaseField.Multiply(static_cast<RSWord>(x), m_Mu);
+}
+
+// u = y^255 = conjugate(y) / y is not in GF(2^8), so it has the prime order 257 and norm 1
+void TowerField::PrecomputeLogarithmTables()
+{
+    const RSWord16 unit = Pow(Combine(1, 0), 255);
+    
+    RSWord16 power = 1;
+    
+    for(uint64_t j = 0; j < m_UnitPowers.size(); j++)
+    {
+        m_UnitPowers[j] = power;
+        
+        if(j > 0)
+            m_UnitLogarithms[m_BaseField.Divide(Low(power), High(power))] = static_cast<uint16_t>(j);
+        
+        power = Multiply(power, unit);
+    }
+    
+    if(power != 1)
+        throw std::logic_error("Tower field unit has the wrong order.");
+}
+
+// ReSharper disable once CppMemberFunctionMayBeStatic
+RSWord16 TowerField::Add(const RSWord16 x, const RSWord16 y) const noexcept // NOLINT(*-convert-member-functions-to-static)
+{
+    return x ^ y;
+}
+
+// ReSharper disable once CppMemberFunctionMayBeStatic
+RSWord16 TowerField::Subtract(const RSWord16 x, const RSWord16 y) const noexcept // NOLINT(*-convert-member-functions-to-static)
+{
+    return x ^ y;
+}
+
+// (a1 y + a0)(b1 y + b0) = a1 b1 y^2 + (a1 b0 + a0 b1) y + a0 b0 with y^2 = y + mu
+RSWord16 TowerField::Multiply(const RSWord16 x, const RSWord16 y) const
+{
+    const RSWord a1 = High(x), a0 = Low(x);
+    const RSWord b1 = High(y), b0 = Low(y);
+    
+    const RSWord high = m_BaseField.Multiply(a1, b1);
+    const RSWord low = m_BaseField.Multiply(a0, b0);
+    const RSWord middle = m_BaseField.Multiply(a1 ^ a0, b1 ^ b0); // a1 b1 + a1 b0 + a0 b1 + a0 b0
+    
+    return Combine(middle ^ low, low ^ m_MultiplyByMu[high]);
+}
+
+RSWord16 TowerField::Divide(const RSWord16 x, const RSWord16 y) const
+{
+    if(y == 0)
+        throw std::invalid_argument("Division by zero.");
+    
+    return Multiply(x, Inverse(y));
+}
+
+RSWord16 TowerField::Pow(RSWord16 x, uint64_t power) const
+{
+    RSWord16 result = 1;
+    
+    while(power)
+    {
+        if(power & 1)
+            result = Multiply(result, x);
+        
+        x = Multiply(x, x);
+        power >>= 1;
+    }
+    
+    return result;
+}
+
+// The conjugate replaces y by the other root y + 1, the product with it is the norm
+RSWord16 TowerField::Inverse(const RSWord16 x) const
+{
+    if(x == 0)
+        throw std::invalid_argument("Zero has no inverse.");
+    
+    const RSWord a1 = High(x), a0 = Low(x);
+    
+    const RSWord norm = m_BaseField.Multiply(a0, a0 ^ a1) ^ m_MultiplyByMu[m_BaseField.Multiply(a1, a1)];
+    const RSWord inverseNorm = m_BaseField.Inverse(norm);
+    
+    return Combine(m_BaseField.Multiply(a1, inverseNorm), m_BaseField.Multiply(a0 ^ a1, inverseNorm));
+}
+
+TowerField::ProductTable TowerField::GetProductTable(const RSWord16 factor) const
+{
+    ProductTable table;
+    
+    // Products with the basis bits, every other entry is the sum of its lowest bit and the rest
+    for(uint64_t b = 0; b < 8; b++)
+    {
+        table.high[1U << b] = Multiply(factor, Combine(static_cast<RSWord>(1U << b), 0));
+        table.low[1U << b] = Multiply(factor, Combine(0, static_cast<RSWord>(1U << b)));
+    }
+    
+    for(uint64_t x = 3; x < 256; x++)
+    {
+        const uint64_t lowestBit = x & (~x + 1);
+        
+        table.high[x] = table.high[x ^ lowestBit] ^ table.high[lowestBit];
+        table.low[x] = table.low[x ^ lowestBit] ^ table.low[lowestBit];
+    }
+    
+    return table;
+}
+
+// x = c * u^j, c = alpha^(k mod 255) and j = k mod 257 are joined by the Chinese remainder theorem
+uint32_t TowerField::Log(const RSWord16 x) const
+{
+    if(x == 0)
+        throw std::invalid_argument("Zero has no logarithm.");
+    
+    const RSWord a1 = High(x), a0 = Low(x);
+    
+    // norm = c^2, halving the logarithm modulo 255 is multiplying it by 128
+    const RSWord norm = m_BaseField.Multiply(a0, a0 ^ a1) ^ m_MultiplyByMu[m_BaseField.Multiply(a1, a1)];
+    const uint32_t subfieldLog = m_BaseField.GetLogarithmicTable()[norm] * 128U % 255U;
+    const uint32_t unitLog = (a1 == 0) ? 0 : m_UnitLogarithms[m_BaseField.Divide(a0, a1)];
+    
+    // 32896 = 1 mod 255 = 0 mod 257, 32640 = 0 mod 255 = 1 mod 257
+    return (subfieldLog * 32896U + unitLog * 32640U) % static_cast<uint32_t>(Modulus);
+}
+
+RSWord16 TowerField::Exp(const uint64_t power) const
+{
+    const RSWord c = m_BaseField.GetExponentialTable()[power % 255];
+    const RSWord16 unitPower = m_UnitPowers[power % 257];
+    
+    return Combine(m_BaseField.Multiply(c, High(unitPower)), m_BaseField.Multiply(c, Low(unitPower)));
+}
+
+void TowerField::MultiplyRegion(RSWord16* const destination, const RSWord16* const source, const RSWord16 factor, const uint64_t length) const
+{
+    if(factor == 0)
+    {
+        std::fill_n(destination, length, 0);
+        return;
+    }
+    
+    if(length < MinProductTableLength)
+        MultiplyShortRegion<false>(*this, destination, source, factor, length);
+    else
+        MultiplyRegion(destination, source, GetProductTable(factor), length);
+}
+
+void TowerField::MultiplyAccumulate(RSWord16* const destination, const RSWord16* const source, const RSWord16 factor, const uint64_t length) const
+{
+    if(factor == 0)
+        return;
+    
+    if(length < MinProductTableLength)
+        MultiplyShortRegion<true>(*this, destination, source, factor, length);
+    else
+        MultiplyAccumulate(destination, source, GetProductTable(factor), length);
+}
+
+// ReSharper disable once CppMemberFunctionMayBeStatic
+void TowerField::MultiplyRegion(RSWord16* const destination, const RSWord16* const source, const ProductTable& table, const uint64_t length) const // NOLINT(*-convert-member-functions-to-static)
+{
+    for(uint64_t i = 0; i < length; i++)
+        destination[i] = table.high[High(source[i])] ^ table.low[Low(source[i])];
+}
+
+// ReSharper disable once CppMemberFunctionMayBeStatic
+void TowerField::MultiplyAccumulate(RSWord16* const destination, const RSWord16* const source, const ProductTable& table, const uint64_t length) const // NOLINT(*-convert-member-functions-to-static)
+{
+    for(uint64_t i = 0; i < length; i++)
+        destination[i] ^= table.high[High(source[i])] ^ table.low[Low(source[i])];
+}